@@ -0,0 +1,86 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <thread>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define BENCH_HAVE_TSC 1
+#else
+#define BENCH_HAVE_TSC 0
+#endif
+
+/*
+ * Timestamp source for the latency benchmarks.
+ *
+ * Tsc reads the CPU's time-stamp counter (~20 cycles, no syscall) and is
+ * converted to nanoseconds with a factor calibrated against steady_clock at
+ * startup. Steady uses std::chrono::steady_clock directly: slower to read
+ * but portable. Tsc falls back to Steady on non-x86 targets.
+ */
+class BenchClock {
+public:
+    enum class Source { Steady, Tsc };
+
+    explicit BenchClock(const Source requested = Source::Tsc)
+        : source{BENCH_HAVE_TSC ? requested : Source::Steady},
+          nanosPerTick{1.0} {
+        if (source == Source::Tsc) {
+            calibrate();
+        }
+    }
+
+    Source getSource() const {
+        return source;
+    }
+
+    const char* getName() const {
+        return source == Source::Tsc ? "rdtsc" : "steady_clock";
+    }
+
+    std::uint64_t now() const {
+#if BENCH_HAVE_TSC
+        if (source == Source::Tsc) {
+            return __rdtsc();
+        }
+#endif
+        return static_cast<std::uint64_t>(
+            std::chrono::steady_clock::now().time_since_epoch().count());
+    }
+
+    std::uint64_t toNanos(const std::uint64_t ticks) const {
+        return static_cast<std::uint64_t>(static_cast<double>(ticks) * nanosPerTick);
+    }
+
+    // Smallest back-to-back now() delta in nanoseconds: the floor under every sample
+    std::uint64_t overheadNanos() const {
+        std::uint64_t best = UINT64_MAX;
+        for (int i = 0; i < 1000; ++i) {
+            const std::uint64_t start = now();
+            const std::uint64_t end = now();
+            if (end - start < best)
+                best = end - start;
+        }
+        return toNanos(best);
+    }
+
+private:
+    void calibrate() {
+        using namespace std::chrono;
+        const auto wallStart = steady_clock::now();
+        const std::uint64_t tickStart = now();
+        std::this_thread::sleep_for(milliseconds(20));
+        const std::uint64_t tickEnd = now();
+        const auto wallEnd = steady_clock::now();
+
+        const double nanos = static_cast<double>(
+            duration_cast<nanoseconds>(wallEnd - wallStart).count());
+        if (tickEnd > tickStart) {
+            nanosPerTick = nanos / static_cast<double>(tickEnd - tickStart);
+        }
+    }
+
+    Source source;
+    double nanosPerTick;
+};
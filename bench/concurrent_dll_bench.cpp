@@ -0,0 +1,179 @@
+/*
+ * Hand-over-hand locking ConcurrentDoublyLinkedList vs. DoublyLinkedList
+ * behind one std::mutex.
+ *
+ * The list holds --size values. Each worker owns a region of it (thread t
+ * works around index t * size / threads) and repeatedly inserts a value there
+ * and deletes it again, with --reads percent of the operations being get()
+ * at the same spot instead. Workers in different regions only meet while
+ * walking past each other, so the per-node locks let them proceed in
+ * parallel; the single mutex runs them one at a time. The sweep goes 1, 2,
+ * 4, ... up to --threads threads.
+ *
+ * Usage:
+ *   concurrent_dll_bench [--threads=N] [--size=N] [--ops=N] [--reads=P] [--seed=N]
+ */
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "concurrentdoublylinkedlist.hpp"
+#include "doublylinkedlist.hpp"
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+struct Options {
+    int threads = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+    int size = 1000;
+    int ops = 20000;
+    int reads = 20;
+    std::uint64_t seed = 1;
+};
+
+[[noreturn]] void usage(const std::string& problem) {
+    std::cerr << "concurrent_dll_bench: " << problem << "\n"
+              << "usage: concurrent_dll_bench [--threads=N] [--size=N] [--ops=N] [--reads=P]"
+                 " [--seed=N]\n";
+    std::exit(2);
+}
+
+int parseCount(const std::string& text, const std::string& flag, const int min) {
+    try {
+        std::size_t used = 0;
+        const int value = std::stoi(text, &used);
+        if (used == text.size() && value >= min)
+            return value;
+    } catch (const std::exception&) {
+    }
+    usage("invalid value for " + flag + ": " + text);
+}
+
+Options parseOptions(const int argc, char** argv) {
+    Options options;
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        const std::size_t eq = arg.find('=');
+        const std::string key = arg.substr(0, eq);
+        const std::string value = eq == std::string::npos ? "" : arg.substr(eq + 1);
+
+        if (key == "--threads") {
+            options.threads = parseCount(value, key, 1);
+        } else if (key == "--size") {
+            options.size = parseCount(value, key, 1);
+        } else if (key == "--ops") {
+            options.ops = parseCount(value, key, 1);
+        } else if (key == "--reads") {
+            options.reads = std::min(parseCount(value, key, 0), 100);
+        } else if (key == "--seed") {
+            options.seed = static_cast<std::uint64_t>(parseCount(value, key, 1));
+        } else {
+            usage("unknown option " + arg);
+        }
+    }
+    return options;
+}
+
+// What we replace: the plain list with one lock around every call
+class MutexDoublyLinkedList {
+public:
+    void append(const int value) {
+        const std::lock_guard<std::mutex> lock(mutex);
+        list.append(value);
+    }
+
+    int get(const int index) const {
+        const std::lock_guard<std::mutex> lock(mutex);
+        const DNode* node = list.get(index);
+        return node ? node->value : 0;
+    }
+
+    bool insertNode(const int index, const int value) {
+        const std::lock_guard<std::mutex> lock(mutex);
+        return list.insertNode(index, value);
+    }
+
+    bool deleteNode(const int index) {
+        const std::lock_guard<std::mutex> lock(mutex);
+        if (index < 0 || index >= list.getLength())
+            return false;
+        list.deleteNode(index);
+        return true;
+    }
+
+private:
+    mutable std::mutex mutex;
+    DoublyLinkedList list;
+};
+
+template <typename List>
+double runWorkers(const Options& options, const int threads) {
+    List list;
+    for (int i = 0; i < options.size; ++i) {
+        list.append(i);
+    }
+
+    std::atomic<int> ready{0};
+    std::atomic<bool> go{false};
+    std::vector<std::thread> workers;
+    for (int t = 0; t < threads; ++t) {
+        workers.emplace_back([&, t] {
+            std::mt19937_64 rng(options.seed * 31 + static_cast<std::uint64_t>(t));
+            const int base = static_cast<int>(static_cast<long long>(t) * options.size / threads);
+            const int span = std::max(1, options.size / threads / 4);
+            ready.fetch_add(1);
+            while (!go.load(std::memory_order_acquire)) {
+                std::this_thread::yield();
+            }
+            for (int i = 0; i < options.ops; ++i) {
+                const std::uint64_t draw = rng();
+                const int index = base + static_cast<int>(draw % static_cast<std::uint64_t>(span));
+                if (static_cast<int>((draw >> 32) % 100) < options.reads) {
+                    list.get(index);
+                } else if (list.insertNode(index, i)) {
+                    list.deleteNode(index); // keep the list at its size
+                }
+            }
+        });
+    }
+    while (ready.load() < threads) {
+        std::this_thread::yield();
+    }
+    const auto start = Clock::now();
+    go.store(true, std::memory_order_release);
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+    const double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+    return static_cast<double>(options.ops) * threads / seconds / 1e6;
+}
+
+} // namespace
+
+int main(const int argc, char** argv) {
+    const Options options = parseOptions(argc, argv);
+
+    std::cout << "size=" << options.size << " ops/thread=" << options.ops
+              << " reads=" << options.reads << "%   (total Mops/s)\n"
+              << "threads  hand-over-hand  single-mutex   speedup\n";
+    for (int threads = 1;; threads = std::min(threads * 2, options.threads)) {
+        const double fine = runWorkers<ConcurrentDoublyLinkedList>(options, threads);
+        const double coarse = runWorkers<MutexDoublyLinkedList>(options, threads);
+        std::cout << std::setw(7) << threads << std::fixed << std::setprecision(3)
+                  << std::setw(16) << fine << std::setw(14) << coarse << std::setw(9)
+                  << fine / coarse << "x\n";
+        if (threads == options.threads)
+            break;
+    }
+    return 0;
+}
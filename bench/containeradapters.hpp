@@ -0,0 +1,81 @@
+#pragma once
+
+#include <chrono>
+#include <climits>
+#include <memory>
+
+#include "blockingqueue.hpp"
+#include "queue.hpp"
+#include "stack.hpp"
+
+/*
+ * Uniform put/take view of the containers the latency driver can exercise.
+ *
+ * To benchmark a new variant, specialise ContainerAdapter for it and add it to
+ * the registry in stackqueue_latency.cpp. take() returns INT_MIN when the
+ * container is empty, like the containers themselves.
+ */
+template <typename Container>
+struct ContainerAdapter;
+
+template <>
+struct ContainerAdapter<Stack> {
+    static constexpr const char* name = "stack";
+    static constexpr const char* putName = "push";
+    static constexpr const char* takeName = "pop";
+
+    static std::unique_ptr<Stack> make() {
+        return std::make_unique<Stack>();
+    }
+
+    static void put(Stack& stack, const int value) {
+        stack.push(value);
+    }
+
+    static int take(Stack& stack) {
+        return stack.pop();
+    }
+};
+
+template <>
+struct ContainerAdapter<Queue> {
+    static constexpr const char* name = "queue";
+    static constexpr const char* putName = "enQueue";
+    static constexpr const char* takeName = "deQueue";
+
+    static std::unique_ptr<Queue> make() {
+        return std::make_unique<Queue>();
+    }
+
+    static void put(Queue& queue, const int value) {
+        queue.enQueue(value);
+    }
+
+    static int take(Queue& queue) {
+        return queue.deQueue();
+    }
+};
+
+template <>
+struct ContainerAdapter<BlockingQueue> {
+    static constexpr const char* name = "blockingqueue";
+    static constexpr const char* putName = "push";
+    static constexpr const char* takeName = "pop";
+
+    // the driver is single-threaded, so the ring must hold --max-depth elements
+    static constexpr int kCapacity = 1 << 20;
+
+    static std::unique_ptr<BlockingQueue> make() {
+        return std::make_unique<BlockingQueue>(kCapacity);
+    }
+
+    static void put(BlockingQueue& queue, const int value) {
+        queue.push(value);
+    }
+
+    static int take(BlockingQueue& queue) {
+        int value = INT_MIN;
+        queue.tryPop(value, std::chrono::milliseconds(0));
+        return value;
+    }
+};
@@ -0,0 +1,133 @@
+/*
+ * Build / traverse / teardown cost of a short-lived LinkedList, heap versus
+ * arena mode.
+ *
+ * Each round appends --size values, runs reverse() and findMiddleNode(), then
+ * destroys the list. In arena mode the nodes come from a
+ * std::pmr::monotonic_buffer_resource that is released after the list is
+ * gone, so teardown is one release() instead of one delete per node.
+ *
+ * Usage:
+ *   linkedlist_arena_bench [--size=N] [--rounds=N]
+ */
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <memory_resource>
+#include <optional>
+#include <string>
+
+#include "linkedlist.hpp"
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+struct Options {
+    int size = 100000;
+    int rounds = 20;
+};
+
+[[noreturn]] void usage(const std::string& problem) {
+    std::cerr << "linkedlist_arena_bench: " << problem << "\n"
+              << "usage: linkedlist_arena_bench [--size=N] [--rounds=N]\n";
+    std::exit(2);
+}
+
+int parsePositive(const std::string& text, const std::string& flag) {
+    try {
+        std::size_t used = 0;
+        const int value = std::stoi(text, &used);
+        if (used == text.size() && value > 0)
+            return value;
+    } catch (const std::exception&) {
+    }
+    usage("invalid value for " + flag + ": " + text);
+}
+
+Options parseOptions(const int argc, char** argv) {
+    Options options;
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        const std::size_t eq = arg.find('=');
+        const std::string key = arg.substr(0, eq);
+        const std::string value = eq == std::string::npos ? "" : arg.substr(eq + 1);
+
+        if (key == "--size") {
+            options.size = parsePositive(value, key);
+        } else if (key == "--rounds") {
+            options.rounds = parsePositive(value, key);
+        } else {
+            usage("unknown option " + arg);
+        }
+    }
+    return options;
+}
+
+struct Phases {
+    double build = 0;
+    double traverse = 0;
+    double teardown = 0;
+};
+
+double nanosSince(const Clock::time_point start) {
+    return static_cast<double>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start)
+            .count());
+}
+
+Phases run(const Options& options, const bool useArena, long long& checksum) {
+    Phases total;
+    std::pmr::monotonic_buffer_resource arena;
+
+    for (int round = 0; round < options.rounds; ++round) {
+        std::optional<LinkedList> list;
+
+        auto start = Clock::now();
+        if (useArena) {
+            list.emplace(0, arena);
+        } else {
+            list.emplace(0);
+        }
+        for (int i = 1; i < options.size; ++i) {
+            list->append(i);
+        }
+        total.build += nanosSince(start);
+
+        start = Clock::now();
+        list->reverse();
+        checksum += list->findMiddleNode()->getData();
+        total.traverse += nanosSince(start);
+
+        start = Clock::now();
+        list.reset();
+        if (useArena) {
+            arena.release();
+        }
+        total.teardown += nanosSince(start);
+    }
+    return total;
+}
+
+void report(const char* name, const Phases& phases, const Options& options) {
+    const double nodes = static_cast<double>(options.size) * options.rounds;
+    std::cout << std::left << std::setw(8) << name << std::right << std::fixed
+              << std::setprecision(2) << " build " << std::setw(8)
+              << phases.build / nodes << " ns/node   traverse " << std::setw(8)
+              << phases.traverse / nodes << " ns/node   teardown " << std::setw(8)
+              << phases.teardown / nodes << " ns/node\n";
+}
+
+} // namespace
+
+int main(const int argc, char** argv) {
+    const Options options = parseOptions(argc, argv);
+    std::cout << "size=" << options.size << " rounds=" << options.rounds << "\n";
+
+    long long checksum = 0;
+    report("heap", run(options, false, checksum), options);
+    report("arena", run(options, true, checksum), options);
+    std::cout << "checksum " << checksum << "\n";
+    return 0;
+}
@@ -0,0 +1,218 @@
+/*
+ * Concurrent membership set: lock-free list vs. a sorted LinkedList behind a
+ * reader/writer lock.
+ *
+ * Every thread runs --ops operations on keys drawn uniformly from
+ * [0, --keys): contains() with probability --reads percent, otherwise an
+ * insert or a remove (half each, so the set stays about half full; it is
+ * prefilled that way too). The sweep runs 1, 2, 4, ... up to --threads
+ * threads for each read percentage and reports total throughput.
+ *
+ * Under the rwlock every write excludes all readers; the lock-free list lets
+ * readers run straight through concurrent writes.
+ *
+ * Usage:
+ *   lockfree_set_bench [--threads=N] [--reads=P[,P...]] [--keys=N] [--ops=N] [--seed=N]
+ */
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <random>
+#include <shared_mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "linkedlist.hpp"
+#include "lockfreelist.hpp"
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+struct Options {
+    int threads = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+    std::vector<int> readPercents{90, 50};
+    int keys = 1024;
+    int ops = 200000;
+    std::uint64_t seed = 1;
+};
+
+[[noreturn]] void usage(const std::string& problem) {
+    std::cerr << "lockfree_set_bench: " << problem << "\n"
+              << "usage: lockfree_set_bench [--threads=N] [--reads=P[,P...]] [--keys=N]"
+                 " [--ops=N] [--seed=N]\n";
+    std::exit(2);
+}
+
+int parsePositive(const std::string& text, const std::string& flag) {
+    try {
+        std::size_t used = 0;
+        const int value = std::stoi(text, &used);
+        if (used == text.size() && value > 0)
+            return value;
+    } catch (const std::exception&) {
+    }
+    usage("invalid value for " + flag + ": " + text);
+}
+
+std::vector<int> parsePercents(const std::string& text, const std::string& flag) {
+    std::vector<int> percents;
+    std::stringstream stream(text);
+    std::string item;
+    while (std::getline(stream, item, ',')) {
+        try {
+            std::size_t used = 0;
+            const int value = std::stoi(item, &used);
+            if (used == item.size() && value >= 0 && value <= 100) {
+                percents.push_back(value);
+                continue;
+            }
+        } catch (const std::exception&) {
+        }
+        usage("invalid value for " + flag + ": " + text);
+    }
+    if (percents.empty())
+        usage("invalid value for " + flag + ": " + text);
+    return percents;
+}
+
+Options parseOptions(const int argc, char** argv) {
+    Options options;
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        const std::size_t eq = arg.find('=');
+        const std::string key = arg.substr(0, eq);
+        const std::string value = eq == std::string::npos ? "" : arg.substr(eq + 1);
+
+        if (key == "--threads") {
+            options.threads = parsePositive(value, key);
+        } else if (key == "--reads") {
+            options.readPercents = parsePercents(value, key);
+        } else if (key == "--keys") {
+            options.keys = parsePositive(value, key);
+        } else if (key == "--ops") {
+            options.ops = parsePositive(value, key);
+        } else if (key == "--seed") {
+            options.seed = static_cast<std::uint64_t>(parsePositive(value, key));
+        } else {
+            usage("unknown option " + arg);
+        }
+    }
+    return options;
+}
+
+// What we replace: a sorted LinkedList guarded by a reader/writer lock
+class RwLockedSortedList {
+public:
+    bool contains(const int key) const {
+        const std::shared_lock<std::shared_mutex> lock(mutex);
+        const Node* node = list.getHead();
+        while (node != nullptr && node->getData() < key) {
+            node = node->getNext();
+        }
+        return node != nullptr && node->getData() == key;
+    }
+
+    bool insert(const int key) {
+        const std::unique_lock<std::shared_mutex> lock(mutex);
+        int index = 0;
+        const Node* node = list.getHead();
+        for (; node != nullptr && node->getData() < key; node = node->getNext()) {
+            ++index;
+        }
+        if (node != nullptr && node->getData() == key)
+            return false;
+        return list.insert(index, key);
+    }
+
+    bool remove(const int key) {
+        const std::unique_lock<std::shared_mutex> lock(mutex);
+        int index = 0;
+        const Node* node = list.getHead();
+        for (; node != nullptr && node->getData() < key; node = node->getNext()) {
+            ++index;
+        }
+        if (node == nullptr || node->getData() != key)
+            return false;
+        list.deleteNode(index);
+        return true;
+    }
+
+private:
+    mutable std::shared_mutex mutex;
+    LinkedList list;
+};
+
+template <typename Set>
+double runMix(const Options& options, const int threads, const int readPercent) {
+    Set set;
+    std::mt19937_64 prefill(options.seed);
+    for (int key = 0; key < options.keys; ++key) {
+        if (prefill() % 2 == 0)
+            set.insert(key);
+    }
+
+    std::atomic<int> ready{0};
+    std::atomic<bool> go{false};
+    std::vector<std::thread> workers;
+    for (int t = 0; t < threads; ++t) {
+        workers.emplace_back([&, t] {
+            std::mt19937_64 rng(options.seed * 7919 + static_cast<std::uint64_t>(t));
+            ready.fetch_add(1);
+            while (!go.load(std::memory_order_acquire)) {
+                std::this_thread::yield();
+            }
+            for (int i = 0; i < options.ops; ++i) {
+                const std::uint64_t draw = rng();
+                const int key = static_cast<int>(draw % static_cast<std::uint64_t>(options.keys));
+                const int roll = static_cast<int>((draw >> 32) % 100);
+                if (roll < readPercent) {
+                    set.contains(key);
+                } else if ((draw >> 40) & 1) {
+                    set.insert(key);
+                } else {
+                    set.remove(key);
+                }
+            }
+        });
+    }
+    while (ready.load() < threads) {
+        std::this_thread::yield();
+    }
+    const auto start = Clock::now();
+    go.store(true, std::memory_order_release);
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+    const double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+    return static_cast<double>(options.ops) * threads / seconds / 1e6;
+}
+
+} // namespace
+
+int main(const int argc, char** argv) {
+    const Options options = parseOptions(argc, argv);
+
+    std::cout << "keys=" << options.keys << " ops/thread=" << options.ops
+              << "   (total Mops/s)\n"
+              << "reads%  threads   lock-free     rwlock   speedup\n";
+    for (const int readPercent : options.readPercents) {
+        for (int threads = 1;; threads = std::min(threads * 2, options.threads)) {
+            const double lockFree = runMix<LockFreeSortedList>(options, threads, readPercent);
+            const double rwLock = runMix<RwLockedSortedList>(options, threads, readPercent);
+            std::cout << std::setw(6) << readPercent << std::setw(9) << threads << std::fixed
+                      << std::setprecision(2) << std::setw(12) << lockFree << std::setw(11)
+                      << rwLock << std::setw(9) << lockFree / rwLock << "x\n";
+            if (threads == options.threads)
+                break;
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,493 @@
+/*
+ * Per-operation hardware counters for every container.
+ *
+ * Each workload builds one container, then runs --ops calls of one operation
+ * between PerfCounters::start() and stop(), and reports per operation: wall
+ * time, cycles, instructions, IPC, L1d read misses, LLC misses and branch
+ * misses. Index- and key-based operations use indices drawn in advance from
+ * [0, --size), so the loop adds one sequential vector read per call.
+ *
+ * The concurrent containers (LockFreeSortedList, ConcurrentDoublyLinkedList,
+ * RcuList, ShardedQueue) run single-threaded here too: the numbers are the
+ * uncontended cost of their synchronization, not their scaling, which the
+ * per-container benchmarks measure.
+ *
+ * Hardware counters need Linux with a PMU the process may use
+ * (perf_event_paranoid <= 2 for user-space counting); without one the
+ * counter columns read n/a and the wall time is still reported.
+ *
+ * Usage:
+ *   perf_counters_bench [--container=NAME|all] [--size=N] [--ops=N] [--seed=N]
+ */
+#include <algorithm>
+#include <chrono>
+#include <climits>
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "asyncqueue.hpp"
+#include "blockingqueue.hpp"
+#include "concurrentdoublylinkedlist.hpp"
+#include "coroexecutor.hpp"
+#include "cowlinkedlist.hpp"
+#include "daryheap.hpp"
+#include "doublylinkedlist.hpp"
+#include "indexedlinkedlist.hpp"
+#include "intrusivelist.hpp"
+#include "linkedlist.hpp"
+#include "lockfreelist.hpp"
+#include "lrucache.hpp"
+#include "perfcounters.hpp"
+#include "persistentlist.hpp"
+#include "queue.hpp"
+#include "rculist.hpp"
+#include "shardedqueue.hpp"
+#include "stack.hpp"
+#include "xorlinkedlist.hpp"
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+struct Options {
+    std::string container = "all";
+    int size = 1000;
+    int ops = 100000;
+    std::uint64_t seed = 1;
+};
+
+[[noreturn]] void usage(const std::string& problem) {
+    std::cerr << "perf_counters_bench: " << problem << "\n"
+              << "usage: perf_counters_bench [--container=NAME|all] [--size=N] [--ops=N]"
+                 " [--seed=N]\n";
+    std::exit(2);
+}
+
+int parsePositive(const std::string& text, const std::string& flag) {
+    try {
+        std::size_t used = 0;
+        const int value = std::stoi(text, &used);
+        if (used == text.size() && value > 0)
+            return value;
+    } catch (const std::exception&) {
+    }
+    usage("invalid value for " + flag + ": " + text);
+}
+
+Options parseOptions(const int argc, char** argv) {
+    Options options;
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        const std::size_t eq = arg.find('=');
+        const std::string key = arg.substr(0, eq);
+        const std::string value = eq == std::string::npos ? "" : arg.substr(eq + 1);
+
+        if (key == "--container") {
+            options.container = value;
+        } else if (key == "--size") {
+            options.size = parsePositive(value, key);
+        } else if (key == "--ops") {
+            options.ops = parsePositive(value, key);
+        } else if (key == "--seed") {
+            options.seed = static_cast<std::uint64_t>(parsePositive(value, key));
+        } else {
+            usage("unknown option " + arg);
+        }
+    }
+    return options;
+}
+
+// Results of reads land here so the optimizer cannot drop the calls
+long long sink = 0;
+
+using Loop = std::function<void(int ops)>;
+
+struct Workload {
+    const char* container;
+    const char* op;
+    /*
+     * Builds the container (unmeasured) and returns the measured loop. The
+     * loop owns the container, so its teardown is not measured either.
+     */
+    std::function<Loop(const Options&, const std::vector<int>& indices)> prepare;
+};
+
+template <typename List>
+std::shared_ptr<List> filledList(const int size) {
+    std::shared_ptr<List> list;
+    int first = 0;
+    if constexpr (std::is_default_constructible_v<List>) {
+        list = std::make_shared<List>();
+    } else {
+        // XorLinkedList and IndexedLinkedList start with one value
+        list = std::make_shared<List>(first++);
+    }
+    for (int i = first; i < size; ++i) {
+        list->append(i);
+    }
+    return list;
+}
+
+struct IntrusiveElement : ListHook<> {
+    int value = 0;
+};
+
+// The list is declared last so it unlinks the elements before they go away
+struct IntrusiveFixture {
+    explicit IntrusiveFixture(const int size)
+        : elements(static_cast<std::size_t>(size)) {
+        for (int i = 0; i < size; ++i) {
+            elements[static_cast<std::size_t>(i)].value = i;
+        }
+    }
+
+    std::vector<IntrusiveElement> elements;
+    IntrusiveList<IntrusiveElement> list;
+};
+
+CoroTask consume(AsyncQueue& queue, const int count) {
+    for (int i = 0; i < count; ++i) {
+        sink += co_await queue.deQueue();
+    }
+}
+
+// Add new containers here: one entry per (container, operation)
+const std::vector<Workload> registry = {
+    {"linkedlist", "append", [](const Options&, const std::vector<int>&) -> Loop {
+         auto list = std::make_shared<LinkedList>();
+         return [list](const int ops) {
+             for (int i = 0; i < ops; ++i)
+                 list->append(i);
+         };
+     }},
+    {"linkedlist", "get", [](const Options& options, const std::vector<int>& indices) -> Loop {
+         auto list = filledList<LinkedList>(options.size);
+         return [list, &indices](const int ops) {
+             for (int i = 0; i < ops; ++i)
+                 sink += list->get(indices[static_cast<std::size_t>(i)])->getData();
+         };
+     }},
+    {"linkedlist", "deleteFirst", [](const Options& options, const std::vector<int>&) -> Loop {
+         auto list = filledList<LinkedList>(options.ops);
+         return [list](const int ops) {
+             for (int i = 0; i < ops; ++i)
+                 list->deleteFirst();
+         };
+     }},
+    {"doublylinkedlist", "append", [](const Options&, const std::vector<int>&) -> Loop {
+         auto list = std::make_shared<DoublyLinkedList>();
+         return [list](const int ops) {
+             for (int i = 0; i < ops; ++i)
+                 list->append(i);
+         };
+     }},
+    {"doublylinkedlist", "get", [](const Options& options, const std::vector<int>& indices) -> Loop {
+         auto list = filledList<DoublyLinkedList>(options.size);
+         return [list, &indices](const int ops) {
+             for (int i = 0; i < ops; ++i)
+                 sink += list->get(indices[static_cast<std::size_t>(i)])->getData();
+         };
+     }},
+    {"doublylinkedlist", "deleteFirst", [](const Options& options, const std::vector<int>&) -> Loop {
+         auto list = filledList<DoublyLinkedList>(options.ops);
+         return [list](const int ops) {
+             for (int i = 0; i < ops; ++i)
+                 list->deleteFirst();
+         };
+     }},
+    {"xorlinkedlist", "get", [](const Options& options, const std::vector<int>& indices) -> Loop {
+         auto list = filledList<XorLinkedList>(options.size);
+         return [list, &indices](const int ops) {
+             for (int i = 0; i < ops; ++i)
+                 sink += list->get(indices[static_cast<std::size_t>(i)]);
+         };
+     }},
+    {"indexedlinkedlist", "get", [](const Options& options, const std::vector<int>& indices) -> Loop {
+         auto list = filledList<IndexedLinkedList>(options.size);
+         return [list, &indices](const int ops) {
+             for (int i = 0; i < ops; ++i)
+                 sink += list->get(indices[static_cast<std::size_t>(i)]);
+         };
+     }},
+    {"stack", "push", [](const Options&, const std::vector<int>&) -> Loop {
+         auto stack = std::make_shared<Stack>();
+         return [stack](const int ops) {
+             for (int i = 0; i < ops; ++i)
+                 stack->push(i);
+         };
+     }},
+    {"stack", "pop", [](const Options& options, const std::vector<int>&) -> Loop {
+         auto stack = std::make_shared<Stack>();
+         for (int i = 0; i < options.ops; ++i)
+             stack->push(i);
+         return [stack](const int ops) {
+             for (int i = 0; i < ops; ++i)
+                 sink += stack->pop();
+         };
+     }},
+    {"queue", "enQueue", [](const Options&, const std::vector<int>&) -> Loop {
+         auto queue = std::make_shared<Queue>();
+         return [queue](const int ops) {
+             for (int i = 0; i < ops; ++i)
+                 queue->enQueue(i);
+         };
+     }},
+    {"queue", "deQueue", [](const Options& options, const std::vector<int>&) -> Loop {
+         auto queue = std::make_shared<Queue>();
+         for (int i = 0; i < options.ops; ++i)
+             queue->enQueue(i);
+         return [queue](const int ops) {
+             for (int i = 0; i < ops; ++i)
+                 sink += queue->deQueue();
+         };
+     }},
+    {"blockingqueue", "push", [](const Options& options, const std::vector<int>&) -> Loop {
+         auto queue = std::make_shared<BlockingQueue>(options.ops);
+         return [queue](const int ops) {
+             for (int i = 0; i < ops; ++i)
+                 queue->push(i);
+         };
+     }},
+    {"blockingqueue", "pop", [](const Options& options, const std::vector<int>&) -> Loop {
+         auto queue = std::make_shared<BlockingQueue>(options.ops);
+         for (int i = 0; i < options.ops; ++i)
+             queue->push(i);
+         return [queue](const int ops) {
+             for (int i = 0; i < ops; ++i)
+                 sink += queue->pop();
+         };
+     }},
+    {"daryheap", "push", [](const Options&, const std::vector<int>& indices) -> Loop {
+         auto heap = std::make_shared<DaryHeap<int>>();
+         return [heap, &indices](const int ops) {
+             for (int i = 0; i < ops; ++i)
+                 heap->push(indices[static_cast<std::size_t>(i)]);
+         };
+     }},
+    {"daryheap", "pop", [](const Options&, const std::vector<int>& indices) -> Loop {
+         auto heap = std::make_shared<DaryHeap<int>>(indices.begin(), indices.end());
+         return [heap](const int ops) {
+             for (int i = 0; i < ops; ++i)
+                 sink += *heap->pop();
+         };
+     }},
+    {"lrucache", "get", [](const Options& options, const std::vector<int>& indices) -> Loop {
+         auto cache = std::make_shared<LRUCache<int, int>>(static_cast<std::size_t>(options.size));
+         for (int key = 0; key < options.size; ++key)
+             cache->put(key, key);
+         return [cache, &indices](const int ops) {
+             for (int i = 0; i < ops; ++i)
+                 sink += *cache->get(indices[static_cast<std::size_t>(i)]);
+         };
+     }},
+    {"lrucache", "put", [](const Options& options, const std::vector<int>& indices) -> Loop {
+         // keys range over 2 * capacity, so about half the puts evict
+         auto cache = std::make_shared<LRUCache<int, int>>(static_cast<std::size_t>(options.size / 2 + 1));
+         return [cache, &indices](const int ops) {
+             for (int i = 0; i < ops; ++i)
+                 cache->put(indices[static_cast<std::size_t>(i)], i);
+         };
+     }},
+    {"intrusivelist", "append", [](const Options& options, const std::vector<int>&) -> Loop {
+         auto fixture = std::make_shared<IntrusiveFixture>(options.ops);
+         return [fixture](const int ops) {
+             for (int i = 0; i < ops; ++i)
+                 fixture->list.append(fixture->elements[static_cast<std::size_t>(i)]);
+         };
+     }},
+    {"intrusivelist", "popFront", [](const Options& options, const std::vector<int>&) -> Loop {
+         auto fixture = std::make_shared<IntrusiveFixture>(options.ops);
+         for (IntrusiveElement& element : fixture->elements)
+             fixture->list.append(element);
+         return [fixture](const int ops) {
+             for (int i = 0; i < ops; ++i)
+                 sink += fixture->list.popFront()->value;
+         };
+     }},
+    {"persistentlist", "prepend", [](const Options&, const std::vector<int>&) -> Loop {
+         auto list = std::make_shared<PersistentList>();
+         return [list](const int ops) {
+             for (int i = 0; i < ops; ++i)
+                 *list = list->prepend(i);
+         };
+     }},
+    {"persistentlist", "get", [](const Options& options, const std::vector<int>& indices) -> Loop {
+         auto list = std::make_shared<PersistentList>();
+         for (int i = 0; i < options.size; ++i)
+             *list = list->prepend(i);
+         return [list, &indices](const int ops) {
+             for (int i = 0; i < ops; ++i)
+                 sink += list->get(indices[static_cast<std::size_t>(i)]);
+         };
+     }},
+    {"cowlinkedlist", "append", [](const Options&, const std::vector<int>&) -> Loop {
+         // never copied, so every append mutates in place after the count check
+         auto list = std::make_shared<CowLinkedList>(LinkedList());
+         return [list](const int ops) {
+             for (int i = 0; i < ops; ++i)
+                 list->append(i);
+         };
+     }},
+    {"cowlinkedlist", "get", [](const Options& options, const std::vector<int>& indices) -> Loop {
+         auto list = std::make_shared<CowLinkedList>(std::move(*filledList<LinkedList>(options.size)));
+         return [list, &indices](const int ops) {
+             for (int i = 0; i < ops; ++i)
+                 sink += list->get(indices[static_cast<std::size_t>(i)])->getData();
+         };
+     }},
+    {"lockfreesortedlist", "insert", [](const Options&, const std::vector<int>& indices) -> Loop {
+         // random keys from [0, --size): the list grows to at most --size
+         auto list = std::make_shared<LockFreeSortedList>();
+         return [list, &indices](const int ops) {
+             for (int i = 0; i < ops; ++i)
+                 sink += list->insert(indices[static_cast<std::size_t>(i)]);
+         };
+     }},
+    {"lockfreesortedlist", "contains", [](const Options& options, const std::vector<int>& indices) -> Loop {
+         auto list = std::make_shared<LockFreeSortedList>();
+         for (int key = 0; key < options.size; ++key)
+             list->insert(key);
+         return [list, &indices](const int ops) {
+             for (int i = 0; i < ops; ++i)
+                 sink += list->contains(indices[static_cast<std::size_t>(i)]);
+         };
+     }},
+    {"concurrentdll", "append", [](const Options&, const std::vector<int>&) -> Loop {
+         auto list = std::make_shared<ConcurrentDoublyLinkedList>();
+         return [list](const int ops) {
+             for (int i = 0; i < ops; ++i)
+                 list->append(i);
+         };
+     }},
+    {"concurrentdll", "get", [](const Options& options, const std::vector<int>& indices) -> Loop {
+         auto list = filledList<ConcurrentDoublyLinkedList>(options.size);
+         return [list, &indices](const int ops) {
+             for (int i = 0; i < ops; ++i)
+                 sink += list->get(indices[static_cast<std::size_t>(i)]);
+         };
+     }},
+    {"rculist", "prepend", [](const Options&, const std::vector<int>&) -> Loop {
+         auto list = std::make_shared<RcuList>();
+         return [list](const int ops) {
+             for (int i = 0; i < ops; ++i)
+                 list->prepend(i);
+         };
+     }},
+    {"rculist", "get", [](const Options& options, const std::vector<int>& indices) -> Loop {
+         auto list = std::make_shared<RcuList>();
+         for (int i = 0; i < options.size; ++i)
+             list->prepend(i);
+         return [list, &indices](const int ops) {
+             for (int i = 0; i < ops; ++i)
+                 sink += list->get(indices[static_cast<std::size_t>(i)]);
+         };
+     }},
+    {"shardedqueue", "enQueue", [](const Options&, const std::vector<int>&) -> Loop {
+         auto queue = std::make_shared<ShardedQueue>();
+         return [queue](const int ops) {
+             for (int i = 0; i < ops; ++i)
+                 queue->enQueue(i);
+         };
+     }},
+    {"shardedqueue", "deQueue", [](const Options& options, const std::vector<int>&) -> Loop {
+         auto queue = std::make_shared<ShardedQueue>();
+         for (int i = 0; i < options.ops; ++i)
+             queue->enQueue(i);
+         return [queue](const int ops) {
+             for (int i = 0; i < ops; ++i)
+                 sink += queue->deQueue();
+         };
+     }},
+    {"asyncqueue", "enQueue", [](const Options&, const std::vector<int>&) -> Loop {
+         // no consumer waiting: every value is stored for later
+         auto queue = std::make_shared<AsyncQueue>();
+         return [queue](const int ops) {
+             for (int i = 0; i < ops; ++i)
+                 queue->enQueue(i);
+         };
+     }},
+    {"asyncqueue", "deQueue", [](const Options& options, const std::vector<int>&) -> Loop {
+         // one coroutine awaits every value; none is missing, so it never suspends
+         auto queue = std::make_shared<AsyncQueue>();
+         for (int i = 0; i < options.ops; ++i)
+             queue->enQueue(i);
+         return [queue](const int ops) {
+             CoroExecutor executor;
+             executor.spawn(consume(*queue, ops));
+             executor.run();
+         };
+     }},
+};
+
+void printPerOp(const PerfCounters::Sample& sample, const PerfCounters::Event event, const int ops) {
+    std::cout << std::setw(11);
+    if (sample.isValid(event)) {
+        std::cout << sample.get(event) / ops;
+    } else {
+        std::cout << "n/a";
+    }
+}
+
+} // namespace
+
+int main(const int argc, char** argv) {
+    const Options options = parseOptions(argc, argv);
+
+    std::mt19937_64 rng(options.seed);
+    std::vector<int> indices(static_cast<std::size_t>(options.ops));
+    for (int& index : indices) {
+        index = static_cast<int>(rng() % static_cast<std::uint64_t>(options.size));
+    }
+
+    PerfCounters counters;
+    std::cout << "size=" << options.size << " ops=" << options.ops << "   (per operation)\n";
+    if (!counters.getStatus().empty())
+        std::cout << counters.getStatus() << "\n";
+    std::cout << "container          op                ns     cycles      instr        IPC"
+                 " L1d-misses LLC-misses br-misses\n";
+
+    bool matched = false;
+    for (const Workload& workload : registry) {
+        if (options.container != "all" && options.container != workload.container)
+            continue;
+        matched = true;
+        const Loop loop = workload.prepare(options, indices);
+
+        counters.start();
+        const auto start = Clock::now();
+        loop(options.ops);
+        const auto end = Clock::now();
+        const PerfCounters::Sample sample = counters.stop();
+
+        const double nanos = std::chrono::duration<double, std::nano>(end - start).count();
+        std::cout << std::left << std::setw(19) << workload.container << std::setw(12)
+                  << workload.op << std::right << std::fixed << std::setprecision(2)
+                  << std::setw(11) << nanos / options.ops;
+        printPerOp(sample, PerfCounters::Cycles, options.ops);
+        printPerOp(sample, PerfCounters::Instructions, options.ops);
+        std::cout << std::setw(11);
+        if (sample.isValid(PerfCounters::Cycles) && sample.isValid(PerfCounters::Instructions) &&
+            sample.get(PerfCounters::Cycles) > 0) {
+            std::cout << sample.get(PerfCounters::Instructions) / sample.get(PerfCounters::Cycles);
+        } else {
+            std::cout << "n/a";
+        }
+        printPerOp(sample, PerfCounters::L1dMisses, options.ops);
+        printPerOp(sample, PerfCounters::LlcMisses, options.ops);
+        printPerOp(sample, PerfCounters::BranchMisses, options.ops);
+        std::cout << "\n";
+    }
+    if (!matched)
+        usage("unknown container " + options.container);
+    std::cout << "(checksum " << sink << ")\n";
+    return 0;
+}
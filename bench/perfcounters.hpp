@@ -0,0 +1,173 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <cerrno>
+#define BENCH_HAVE_PERF 1
+#else
+#define BENCH_HAVE_PERF 0
+#endif
+
+/*
+ * Hardware performance counters for the benchmarks, through Linux
+ * perf_event_open.
+ *
+ * Wall-clock time says how long an operation took; the counters say why:
+ * few instructions per cycle with many cache misses means it is stalling on
+ * memory, many branch misses means it is mispredicting. Each event is opened
+ * on its own for the calling thread (user space only), so a CPU or VM that
+ * lacks one event still reports the others. Counts are scaled up when the
+ * kernel had to multiplex the events onto fewer hardware counters.
+ *
+ * Graceful fallback: when an event cannot be opened (no PMU in a VM,
+ * perf_event_paranoid too strict, not Linux) it is reported as unavailable
+ * and getStatus() says why; callers print n/a and keep their wall-clock
+ * numbers.
+ *
+ *     PerfCounters counters;
+ *     counters.start();
+ *     ... n operations ...
+ *     const PerfCounters::Sample sample = counters.stop();
+ *     if (sample.isValid(PerfCounters::Cycles))
+ *         cyclesPerOp = sample.get(PerfCounters::Cycles) / n;
+ */
+class PerfCounters {
+public:
+    enum Event { Cycles, Instructions, L1dMisses, LlcMisses, BranchMisses, kEventCount };
+
+    class Sample {
+    public:
+        bool isValid(const Event event) const {
+            return valid[event];
+        }
+        double get(const Event event) const {
+            return values[event];
+        }
+
+    private:
+        friend class PerfCounters;
+
+        std::array<double, kEventCount> values{};
+        std::array<bool, kEventCount> valid{};
+    };
+
+    PerfCounters() {
+        fds.fill(-1);
+#if BENCH_HAVE_PERF
+        int firstError = 0;
+        for (int event = 0; event < kEventCount; ++event) {
+            fds[event] = open(static_cast<Event>(event));
+            if (fds[event] < 0 && firstError == 0)
+                firstError = errno;
+        }
+        if (!isAvailable(Cycles)) {
+            status = std::string("hardware counters unavailable: ") + std::strerror(firstError) +
+                     (firstError == EACCES || firstError == EPERM
+                          ? " (lower /proc/sys/kernel/perf_event_paranoid)"
+                          : " (no PMU exposed, e.g. inside a VM)");
+        }
+#else
+        status = "hardware counters unavailable: perf_event_open is Linux-only";
+#endif
+    }
+
+    ~PerfCounters() {
+#if BENCH_HAVE_PERF
+        for (const int fd : fds) {
+            if (fd >= 0)
+                close(fd);
+        }
+#endif
+    }
+
+    PerfCounters(const PerfCounters&) = delete;
+    PerfCounters& operator=(const PerfCounters&) = delete;
+
+    bool isAvailable(const Event event) const {
+        return fds[event] >= 0;
+    }
+
+    // Empty when the hardware events opened; otherwise the reason they did not
+    const std::string& getStatus() const {
+        return status;
+    }
+
+    void start() {
+#if BENCH_HAVE_PERF
+        for (const int fd : fds) {
+            if (fd >= 0) {
+                ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+                ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+            }
+        }
+#endif
+    }
+
+    Sample stop() {
+        Sample sample;
+#if BENCH_HAVE_PERF
+        for (const int fd : fds) {
+            if (fd >= 0)
+                ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+        }
+        for (int event = 0; event < kEventCount; ++event) {
+            std::uint64_t data[3] = {}; // value, time enabled, time running
+            if (fds[event] < 0 || read(fds[event], data, sizeof(data)) != sizeof(data))
+                continue;
+            if (data[2] == 0)
+                continue; // never got a hardware counter
+            sample.values[event] = static_cast<double>(data[0]) * static_cast<double>(data[1]) /
+                                   static_cast<double>(data[2]);
+            sample.valid[event] = true;
+        }
+#endif
+        return sample;
+    }
+
+private:
+#if BENCH_HAVE_PERF
+    static int open(const Event event) {
+        perf_event_attr attr{};
+        attr.size = sizeof(attr);
+        attr.disabled = 1;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+        attr.type = PERF_TYPE_HARDWARE;
+        switch (event) {
+        case Cycles:
+            attr.config = PERF_COUNT_HW_CPU_CYCLES;
+            break;
+        case Instructions:
+            attr.config = PERF_COUNT_HW_INSTRUCTIONS;
+            break;
+        case L1dMisses:
+            attr.type = PERF_TYPE_HW_CACHE;
+            attr.config = PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+                          (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+            break;
+        case LlcMisses:
+            attr.config = PERF_COUNT_HW_CACHE_MISSES;
+            break;
+        case BranchMisses:
+        case kEventCount:
+            attr.config = PERF_COUNT_HW_BRANCH_MISSES;
+            break;
+        }
+        // this thread, any CPU, no group
+        return static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+    }
+#endif
+
+    std::array<int, kEventCount> fds{};
+    std::string status;
+};
@@ -0,0 +1,199 @@
+/*
+ * Pipeline example: parse -> filter -> reduce over a stream of integers.
+ *
+ * The source writes --count random integers as comma-separated text and
+ * streams its characters into the pipeline. The stages:
+ *
+ *   parse   (1 thread)  turns the characters back into integers, carrying a
+ *                       partly read number over from one batch to the next
+ *   filter  (--filter-threads) keeps the values below --limit: the front part
+ *                       of the split LinkedList::partitionList(limit) makes
+ *   reduce  (1 thread)  keeps count, sum, min and max
+ *
+ * The result is checked against the same computation done directly, then
+ * the per-stage metrics are printed. A small --capacity shows backpressure:
+ * the source and the early stages spend their time blocked.
+ *
+ * Usage:
+ *   pipeline_example [--count=N] [--limit=N] [--capacity=N] [--batch=N]
+ *                    [--filter-threads=N] [--seed=N]
+ */
+#include <algorithm>
+#include <climits>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "pipeline.hpp"
+
+namespace {
+
+struct Options {
+    int count = 200000;
+    int limit = 0;
+    int capacity = 4096;
+    int batch = 256;
+    int filterThreads = 2;
+    std::uint64_t seed = 1;
+};
+
+[[noreturn]] void usage(const std::string& problem) {
+    std::cerr << "pipeline_example: " << problem << "\n"
+              << "usage: pipeline_example [--count=N] [--limit=N] [--capacity=N] [--batch=N]"
+                 " [--filter-threads=N] [--seed=N]\n";
+    std::exit(2);
+}
+
+int parseInt(const std::string& text, const std::string& flag, const int min) {
+    try {
+        std::size_t used = 0;
+        const int value = std::stoi(text, &used);
+        if (used == text.size() && value >= min)
+            return value;
+    } catch (const std::exception&) {
+    }
+    usage("invalid value for " + flag + ": " + text);
+}
+
+Options parseOptions(const int argc, char** argv) {
+    Options options;
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        const std::size_t eq = arg.find('=');
+        const std::string key = arg.substr(0, eq);
+        const std::string value = eq == std::string::npos ? "" : arg.substr(eq + 1);
+
+        if (key == "--count") {
+            options.count = parseInt(value, key, 1);
+        } else if (key == "--limit") {
+            options.limit = parseInt(value, key, INT_MIN + 1);
+        } else if (key == "--capacity") {
+            options.capacity = parseInt(value, key, 1);
+        } else if (key == "--batch") {
+            options.batch = parseInt(value, key, 1);
+        } else if (key == "--filter-threads") {
+            options.filterThreads = parseInt(value, key, 1);
+        } else if (key == "--seed") {
+            options.seed = static_cast<std::uint64_t>(parseInt(value, key, 1));
+        } else {
+            usage("unknown option " + arg);
+        }
+    }
+    return options;
+}
+
+struct Summary {
+    long long count = 0;
+    long long sum = 0;
+    int min = INT_MAX;
+    int max = INT_MIN;
+
+    void add(const int value) {
+        ++count;
+        sum += value;
+        min = std::min(min, value);
+        max = std::max(max, value);
+    }
+
+    bool operator==(const Summary&) const = default;
+};
+
+// Text parser whose state survives across batches
+class NumberParser {
+public:
+    void feed(const Pipeline::Batch& characters, Pipeline::Batch& numbers) {
+        for (const int character : characters) {
+            if (character == '-') {
+                negative = true;
+            } else if (character >= '0' && character <= '9') {
+                current = current * 10 + (character - '0');
+                inNumber = true;
+            } else if (inNumber) {
+                numbers.push_back(static_cast<int>(negative ? -current : current));
+                current = 0;
+                inNumber = negative = false;
+            }
+        }
+    }
+
+private:
+    long long current = 0;
+    bool inNumber = false;
+    bool negative = false;
+};
+
+} // namespace
+
+int main(const int argc, char** argv) {
+    const Options options = parseOptions(argc, argv);
+
+    std::mt19937_64 rng(options.seed);
+    std::uniform_int_distribution<int> distribution(-1000000, 1000000);
+    std::vector<int> numbers(static_cast<std::size_t>(options.count));
+    for (int& number : numbers) {
+        number = distribution(rng);
+    }
+
+    Summary expected;
+    for (const int number : numbers) {
+        if (number < options.limit)
+            expected.add(number);
+    }
+
+    Pipeline pipeline(options.capacity, options.batch);
+    NumberParser parser;
+    Summary actual;
+    const int limit = options.limit;
+    pipeline.addStage("parse", [&parser](const Pipeline::Batch& in, Pipeline::Batch& out) {
+        parser.feed(in, out);
+    });
+    pipeline.addStage("filter", [limit](const Pipeline::Batch& in, Pipeline::Batch& out) {
+        out = in;
+        const auto split = std::stable_partition(out.begin(), out.end(),
+                                                 [limit](const int value) { return value < limit; });
+        out.erase(split, out.end());
+    }, options.filterThreads);
+    pipeline.addStage("reduce", [&actual](const Pipeline::Batch& in, Pipeline::Batch&) {
+        for (const int value : in)
+            actual.add(value);
+    });
+    pipeline.start();
+
+    Pipeline::Batch characters;
+    for (const int number : numbers) {
+        for (const char character : std::to_string(number) + ",") {
+            characters.push_back(character);
+        }
+        if (static_cast<int>(characters.size()) >= options.batch) {
+            pipeline.pushBatch(characters);
+            characters.clear();
+        }
+    }
+    pipeline.pushBatch(characters);
+    pipeline.close();
+    pipeline.wait();
+
+    std::cout << "kept " << actual.count << " of " << options.count << " values below "
+              << options.limit << ": sum=" << actual.sum << " min=" << actual.min
+              << " max=" << actual.max << "\n\n"
+              << "stage    threads   values in  values out    Mvalues/s   busy s  blocked s"
+                 "  max depth\n";
+    for (const Pipeline::StageMetrics& stage : pipeline.getMetrics()) {
+        std::cout << std::left << std::setw(8) << stage.name << std::right << std::setw(8)
+                  << stage.threads << std::setw(12) << stage.valuesIn << std::setw(12)
+                  << stage.valuesOut << std::fixed << std::setprecision(3) << std::setw(13)
+                  << stage.valuesPerSecond / 1e6 << std::setw(9) << stage.busySeconds
+                  << std::setw(11) << stage.blockedSeconds << std::setw(11)
+                  << stage.maxQueueDepth << "\n";
+    }
+
+    if (!(actual == expected)) {
+        std::cerr << "pipeline_example: result differs from the direct computation\n";
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,156 @@
+/*
+ * Priority-queue throughput: d-ary heaps versus a sorted DoublyLinkedList.
+ *
+ * Runs the classic "hold" workload: fill the queue with --size jobs, then do
+ * --ops rounds of pop-the-most-urgent / push-a-new-job, so the queue stays at
+ * a steady size. The sorted list pays an O(n) walk per push; the heaps pay
+ * O(log n). Reports nanoseconds per pop+push round, plus a checksum of the
+ * popped values: equal checksums mean every queue popped in the same order.
+ *
+ * Usage:
+ *   priorityqueue_bench [--size=N] [--ops=N] [--seed=N]
+ */
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+
+#include "daryheap.hpp"
+#include "doublylinkedlist.hpp"
+
+namespace {
+
+struct Options {
+    int size = 10000;
+    int ops = 200000;
+    std::uint64_t seed = 1;
+};
+
+[[noreturn]] void usage(const std::string& problem) {
+    std::cerr << "priorityqueue_bench: " << problem << "\n"
+              << "usage: priorityqueue_bench [--size=N] [--ops=N] [--seed=N]\n";
+    std::exit(2);
+}
+
+int parsePositive(const std::string& text, const std::string& flag) {
+    try {
+        std::size_t used = 0;
+        const int value = std::stoi(text, &used);
+        if (used == text.size() && value > 0)
+            return value;
+    } catch (const std::exception&) {
+    }
+    usage("invalid value for " + flag + ": " + text);
+}
+
+Options parseOptions(const int argc, char** argv) {
+    Options options;
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        const std::size_t eq = arg.find('=');
+        const std::string key = arg.substr(0, eq);
+        const std::string value = eq == std::string::npos ? "" : arg.substr(eq + 1);
+
+        if (key == "--size") {
+            options.size = parsePositive(value, key);
+        } else if (key == "--ops") {
+            options.ops = parsePositive(value, key);
+        } else if (key == "--seed") {
+            options.seed = static_cast<std::uint64_t>(parsePositive(value, key));
+        } else {
+            usage("unknown option " + arg);
+        }
+    }
+    return options;
+}
+
+// Keeps the list in ascending order: walk to the first larger value
+class SortedListQueue {
+public:
+    void push(const int value) {
+        DNode* node = list.getHead();
+        while (node && node->value <= value) {
+            node = node->next;
+        }
+        if (node) {
+            list.insertBefore(node, value);
+        } else {
+            list.append(value);
+        }
+    }
+
+    int pop() {
+        const int value = list.getHead()->value;
+        list.deleteFirst();
+        return value;
+    }
+
+private:
+    DoublyLinkedList list;
+};
+
+template <typename Heap>
+struct HeapQueue {
+    Heap heap;
+
+    void push(const int value) {
+        heap.push(value);
+    }
+
+    int pop() {
+        return *heap.pop();
+    }
+};
+
+/*
+ * New jobs get "now + random delay", so priorities drift upward like real
+ * deadlines instead of piling up at one end of the queue.
+ */
+template <typename PriorityQueue>
+double holdNanosPerOp(const Options& options, long long& checksum) {
+    std::mt19937 rng(static_cast<std::mt19937::result_type>(options.seed));
+    std::uniform_int_distribution<int> delay(1, options.size);
+
+    PriorityQueue queue;
+    for (int i = 0; i < options.size; ++i) {
+        queue.push(delay(rng));
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < options.ops; ++i) {
+        const int now = queue.pop();
+        checksum += now;
+        queue.push(now + delay(rng));
+    }
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+    return static_cast<double>(
+               std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()) /
+        options.ops;
+}
+
+template <typename PriorityQueue>
+void report(const char* name, const Options& options) {
+    long long checksum = 0;
+    const double nanos = holdNanosPerOp<PriorityQueue>(options, checksum);
+    std::cout << std::left << std::setw(24) << name << std::right << std::fixed
+              << std::setprecision(1) << std::setw(12) << nanos
+              << " ns/op   (checksum " << checksum << ")\n";
+}
+
+} // namespace
+
+int main(const int argc, char** argv) {
+    const Options options = parseOptions(argc, argv);
+    std::cout << "hold workload: size=" << options.size << " ops=" << options.ops
+              << "\n";
+
+    report<HeapQueue<DaryHeap<int, 2>>>("binary heap", options);
+    report<HeapQueue<DaryHeap<int, 4>>>("4-ary heap", options);
+    report<HeapQueue<DaryHeap<int, 8>>>("8-ary heap", options);
+    report<HeapQueue<AddressableDaryHeap<int, 4>>>("addressable 4-ary heap", options);
+    report<SortedListQueue>("sorted DoublyLinkedList", options);
+    return 0;
+}
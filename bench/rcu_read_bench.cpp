@@ -0,0 +1,178 @@
+/*
+ * Read-mostly list: RcuList vs. a LinkedList behind a reader/writer lock.
+ *
+ * The list holds --size values. Reader threads call contains() on random
+ * values for a fixed time while one writer replaces a random element with
+ * set() every --interval microseconds (0 = no writer). The sweep runs 1, 2,
+ * 4, ... up to --threads readers and reports total read throughput.
+ *
+ * A shared_lock still writes the lock word on every read, so readers on
+ * different cores fight over one cache line even with no writer; RcuList
+ * readers only store to their own epoch slot.
+ *
+ * Usage:
+ *   rcu_read_bench [--threads=N] [--size=N] [--interval=US] [--millis=N] [--seed=N]
+ */
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <random>
+#include <shared_mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "linkedlist.hpp"
+#include "rculist.hpp"
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+struct Options {
+    int threads = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+    int size = 256;
+    int interval = 1000;
+    int millis = 200;
+    std::uint64_t seed = 1;
+};
+
+[[noreturn]] void usage(const std::string& problem) {
+    std::cerr << "rcu_read_bench: " << problem << "\n"
+              << "usage: rcu_read_bench [--threads=N] [--size=N] [--interval=US] [--millis=N]"
+                 " [--seed=N]\n";
+    std::exit(2);
+}
+
+int parseCount(const std::string& text, const std::string& flag, const int min) {
+    try {
+        std::size_t used = 0;
+        const int value = std::stoi(text, &used);
+        if (used == text.size() && value >= min)
+            return value;
+    } catch (const std::exception&) {
+    }
+    usage("invalid value for " + flag + ": " + text);
+}
+
+Options parseOptions(const int argc, char** argv) {
+    Options options;
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        const std::size_t eq = arg.find('=');
+        const std::string key = arg.substr(0, eq);
+        const std::string value = eq == std::string::npos ? "" : arg.substr(eq + 1);
+
+        if (key == "--threads") {
+            options.threads = parseCount(value, key, 1);
+        } else if (key == "--size") {
+            options.size = parseCount(value, key, 1);
+        } else if (key == "--interval") {
+            options.interval = parseCount(value, key, 0);
+        } else if (key == "--millis") {
+            options.millis = parseCount(value, key, 1);
+        } else if (key == "--seed") {
+            options.seed = static_cast<std::uint64_t>(parseCount(value, key, 1));
+        } else {
+            usage("unknown option " + arg);
+        }
+    }
+    return options;
+}
+
+// What we replace: a LinkedList guarded by a reader/writer lock
+class RwLockedList {
+public:
+    void append(const int value) {
+        const std::unique_lock<std::shared_mutex> lock(mutex);
+        list.append(value);
+    }
+
+    bool contains(const int value) const {
+        const std::shared_lock<std::shared_mutex> lock(mutex);
+        for (const Node* node = list.getHead(); node != nullptr; node = node->getNext()) {
+            if (node->getData() == value)
+                return true;
+        }
+        return false;
+    }
+
+    bool set(const int index, const int value) {
+        const std::unique_lock<std::shared_mutex> lock(mutex);
+        return list.set(index, value);
+    }
+
+private:
+    mutable std::shared_mutex mutex;
+    LinkedList list;
+};
+
+template <typename List>
+double runReaders(const Options& options, const int threads) {
+    List list;
+    for (int i = 0; i < options.size; ++i) {
+        list.append(i);
+    }
+
+    std::atomic<bool> stop{false};
+    std::atomic<long long> reads{0};
+    std::vector<std::thread> readers;
+    for (int t = 0; t < threads; ++t) {
+        readers.emplace_back([&, t] {
+            std::mt19937_64 rng(options.seed * 131 + static_cast<std::uint64_t>(t));
+            long long done = 0;
+            while (!stop.load(std::memory_order_relaxed)) {
+                // values stay in [0, 2 * size), so about half the lookups hit
+                list.contains(static_cast<int>(rng() % (2 * static_cast<std::uint64_t>(options.size))));
+                ++done;
+            }
+            reads.fetch_add(done);
+        });
+    }
+
+    std::thread writer([&] {
+        if (options.interval == 0)
+            return;
+        std::mt19937_64 rng(options.seed);
+        while (!stop.load(std::memory_order_relaxed)) {
+            const int index = static_cast<int>(rng() % static_cast<std::uint64_t>(options.size));
+            list.set(index, static_cast<int>(rng() % (2 * static_cast<std::uint64_t>(options.size))));
+            std::this_thread::sleep_for(std::chrono::microseconds(options.interval));
+        }
+    });
+
+    const auto start = Clock::now();
+    std::this_thread::sleep_for(std::chrono::milliseconds(options.millis));
+    stop.store(true);
+    for (std::thread& reader : readers) {
+        reader.join();
+    }
+    const double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+    writer.join();
+    return static_cast<double>(reads.load()) / seconds / 1e6;
+}
+
+} // namespace
+
+int main(const int argc, char** argv) {
+    const Options options = parseOptions(argc, argv);
+
+    std::cout << "size=" << options.size << " write every " << options.interval
+              << "us  millis=" << options.millis << "   (total read Mops/s)\n"
+              << "readers         rcu     rwlock   speedup\n";
+    for (int threads = 1;; threads = std::min(threads * 2, options.threads)) {
+        const double rcu = runReaders<RcuList>(options, threads);
+        const double rwLock = runReaders<RwLockedList>(options, threads);
+        std::cout << std::setw(7) << threads << std::fixed << std::setprecision(3)
+                  << std::setw(12) << rcu << std::setw(11) << rwLock << std::setw(9)
+                  << rcu / rwLock << "x\n";
+        if (threads == options.threads)
+            break;
+    }
+    return 0;
+}
@@ -0,0 +1,153 @@
+/*
+ * Task fan-out: ShardedQueue vs. one Queue behind a std::mutex.
+ *
+ * Every thread runs --ops rounds of "enqueue --batch values, then dequeue
+ * --batch values", the pattern of a worker that spawns subtasks and then
+ * picks up work. With the sharded queue a thread mostly hits its own shard
+ * and only steals when it runs dry; with the single mutex every operation
+ * of every thread goes through the same lock and the same head/tail nodes.
+ * The sweep runs 1, 2, 4, ... up to --threads threads.
+ *
+ * Usage:
+ *   sharded_queue_bench [--threads=N] [--ops=N] [--batch=N] [--shards=N]
+ */
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <climits>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "queue.hpp"
+#include "shardedqueue.hpp"
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+struct Options {
+    int threads = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+    int ops = 20000;
+    int batch = 8;
+    int shards = 0;
+};
+
+[[noreturn]] void usage(const std::string& problem) {
+    std::cerr << "sharded_queue_bench: " << problem << "\n"
+              << "usage: sharded_queue_bench [--threads=N] [--ops=N] [--batch=N] [--shards=N]\n";
+    std::exit(2);
+}
+
+int parseCount(const std::string& text, const std::string& flag, const int min) {
+    try {
+        std::size_t used = 0;
+        const int value = std::stoi(text, &used);
+        if (used == text.size() && value >= min)
+            return value;
+    } catch (const std::exception&) {
+    }
+    usage("invalid value for " + flag + ": " + text);
+}
+
+Options parseOptions(const int argc, char** argv) {
+    Options options;
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        const std::size_t eq = arg.find('=');
+        const std::string key = arg.substr(0, eq);
+        const std::string value = eq == std::string::npos ? "" : arg.substr(eq + 1);
+
+        if (key == "--threads") {
+            options.threads = parseCount(value, key, 1);
+        } else if (key == "--ops") {
+            options.ops = parseCount(value, key, 1);
+        } else if (key == "--batch") {
+            options.batch = parseCount(value, key, 1);
+        } else if (key == "--shards") {
+            options.shards = parseCount(value, key, 0);
+        } else {
+            usage("unknown option " + arg);
+        }
+    }
+    return options;
+}
+
+// What we replace: the plain queue with one lock around every call
+class MutexQueue {
+public:
+    explicit MutexQueue(int) {
+    }
+
+    void enQueue(const int value) {
+        const std::lock_guard<std::mutex> lock(mutex);
+        queue.enQueue(value);
+    }
+
+    int deQueue() {
+        const std::lock_guard<std::mutex> lock(mutex);
+        return queue.getSize() == 0 ? INT_MIN : queue.deQueue();
+    }
+
+private:
+    std::mutex mutex;
+    Queue queue;
+};
+
+template <typename Q>
+double runFanOut(const Options& options, const int threads) {
+    Q queue(options.shards);
+    std::atomic<int> ready{0};
+    std::atomic<bool> go{false};
+    std::vector<std::thread> workers;
+    for (int t = 0; t < threads; ++t) {
+        workers.emplace_back([&] {
+            ready.fetch_add(1);
+            while (!go.load(std::memory_order_acquire)) {
+                std::this_thread::yield();
+            }
+            for (int i = 0; i < options.ops; ++i) {
+                for (int j = 0; j < options.batch; ++j) {
+                    queue.enQueue(i);
+                }
+                for (int j = 0; j < options.batch; ++j) {
+                    queue.deQueue();
+                }
+            }
+        });
+    }
+    while (ready.load() < threads) {
+        std::this_thread::yield();
+    }
+    const auto start = Clock::now();
+    go.store(true, std::memory_order_release);
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+    const double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+    return 2.0 * options.ops * options.batch * threads / seconds / 1e6;
+}
+
+} // namespace
+
+int main(const int argc, char** argv) {
+    const Options options = parseOptions(argc, argv);
+
+    std::cout << "ops/thread=" << options.ops << " batch=" << options.batch
+              << "   (total Mops/s)\n"
+              << "threads     sharded  single-mutex   speedup\n";
+    for (int threads = 1;; threads = std::min(threads * 2, options.threads)) {
+        const double sharded = runFanOut<ShardedQueue>(options, threads);
+        const double single = runFanOut<MutexQueue>(options, threads);
+        std::cout << std::setw(7) << threads << std::fixed << std::setprecision(3)
+                  << std::setw(12) << sharded << std::setw(14) << single << std::setw(9)
+                  << sharded / single << "x\n";
+        if (threads == options.threads)
+            break;
+    }
+    return 0;
+}
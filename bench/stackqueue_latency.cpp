@@ -0,0 +1,272 @@
+/*
+ * Per-operation latency driver for Stack, Queue and future variants.
+ *
+ * Every put and take is timed on its own and recorded in a LatencyHistogram,
+ * together with each element's put-to-take time (its sojourn: enqueue-to-
+ * dequeue for a queue). Results are printed as percentiles, because the tail
+ * (p99.9) is what an SLO is written against, not the mean.
+ *
+ * Usage:
+ *   stackqueue_latency [--container=stack|queue|blockingqueue|all] [--ops=N] [--mix=P:C]
+ *                      [--pattern=round|random] [--prefill=N] [--max-depth=N]
+ *                      [--warmup=N] [--clock=tsc|steady] [--seed=N]
+ *
+ * --mix=P:C is the producer/consumer ratio: P puts for every C takes. With
+ * --pattern=round they run in blocks (P puts, then C takes); with random each
+ * operation is a put with probability P/(P+C). A take on an empty container
+ * becomes a put, and a put at --max-depth becomes a take, so any mix runs
+ * to completion.
+ */
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "benchclock.hpp"
+#include "containeradapters.hpp"
+#include "latencyhistogram.hpp"
+
+namespace {
+
+struct Options {
+    std::string container = "all";
+    std::uint64_t ops = 1000000;
+    std::uint64_t producers = 1;
+    std::uint64_t consumers = 1;
+    bool randomPattern = false;
+    std::uint64_t prefill = 0;
+    std::uint64_t maxDepth = 65536;
+    std::uint64_t warmup = 100000;
+    BenchClock::Source clock = BenchClock::Source::Tsc;
+    std::uint64_t seed = 1;
+};
+
+[[noreturn]] void usage(const std::string& problem) {
+    std::cerr << "stackqueue_latency: " << problem << "\n"
+              << "usage: stackqueue_latency [--container=stack|queue|blockingqueue|all] [--ops=N]\n"
+              << "       [--mix=P:C] [--pattern=round|random] [--prefill=N]\n"
+              << "       [--max-depth=N] [--warmup=N] [--clock=tsc|steady] [--seed=N]\n";
+    std::exit(2);
+}
+
+std::uint64_t parseCount(const std::string& text, const std::string& flag) {
+    try {
+        std::size_t used = 0;
+        const unsigned long long value = std::stoull(text, &used);
+        if (used == text.size())
+            return value;
+    } catch (const std::exception&) {
+    }
+    usage("invalid number for " + flag + ": " + text);
+}
+
+Options parseOptions(const int argc, char** argv) {
+    Options options;
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        const std::size_t eq = arg.find('=');
+        const std::string key = arg.substr(0, eq);
+        const std::string value = eq == std::string::npos ? "" : arg.substr(eq + 1);
+
+        if (key == "--container") {
+            options.container = value;
+        } else if (key == "--ops") {
+            options.ops = parseCount(value, key);
+        } else if (key == "--mix") {
+            const std::size_t colon = value.find(':');
+            if (colon == std::string::npos)
+                usage("--mix expects P:C, e.g. --mix=3:1");
+            options.producers = parseCount(value.substr(0, colon), key);
+            options.consumers = parseCount(value.substr(colon + 1), key);
+            if (options.producers + options.consumers == 0)
+                usage("--mix needs at least one producer or consumer");
+        } else if (key == "--pattern") {
+            if (value != "round" && value != "random")
+                usage("--pattern must be round or random");
+            options.randomPattern = value == "random";
+        } else if (key == "--prefill") {
+            options.prefill = parseCount(value, key);
+            // a single thread pushing into a full BlockingQueue would wait forever
+            if (options.prefill > static_cast<std::uint64_t>(
+                                      ContainerAdapter<BlockingQueue>::kCapacity))
+                usage("--prefill must be at most 1048576");
+        } else if (key == "--max-depth") {
+            options.maxDepth = parseCount(value, key);
+            if (options.maxDepth == 0 ||
+                options.maxDepth > static_cast<std::uint64_t>(
+                    ContainerAdapter<BlockingQueue>::kCapacity))
+                usage("--max-depth must be between 1 and 1048576");
+        } else if (key == "--warmup") {
+            options.warmup = parseCount(value, key);
+        } else if (key == "--clock") {
+            if (value != "tsc" && value != "steady")
+                usage("--clock must be tsc or steady");
+            options.clock = value == "tsc" ? BenchClock::Source::Tsc
+                                           : BenchClock::Source::Steady;
+        } else if (key == "--seed") {
+            options.seed = parseCount(value, key);
+        } else if (key == "--help" || key == "-h") {
+            usage("per-operation latency percentiles for Stack and Queue");
+        } else {
+            usage("unknown option " + arg);
+        }
+    }
+    return options;
+}
+
+struct LatencyResult {
+    LatencyHistogram put;
+    LatencyHistogram take;
+    LatencyHistogram sojourn;
+};
+
+// Decides, operation by operation, whether the next one is a put or a take
+class MixSchedule {
+public:
+    explicit MixSchedule(const Options& options)
+        : producers{options.producers},
+          consumers{options.consumers},
+          randomPattern{options.randomPattern},
+          position{0},
+          rng(options.seed),
+          coin(static_cast<double>(options.producers) /
+               static_cast<double>(options.producers + options.consumers)) {
+    }
+
+    bool nextIsPut() {
+        if (randomPattern)
+            return coin(rng);
+        const bool put = position < producers;
+        position = (position + 1) % (producers + consumers);
+        return put;
+    }
+
+private:
+    std::uint64_t producers;
+    std::uint64_t consumers;
+    bool randomPattern;
+    std::uint64_t position;
+    std::mt19937_64 rng;
+    std::bernoulli_distribution coin;
+};
+
+template <typename Container>
+LatencyResult runLatency(const Options& options, const BenchClock& clock) {
+    using Adapter = ContainerAdapter<Container>;
+
+    const std::uint64_t totalPuts = options.prefill + options.warmup + options.ops;
+    if (totalPuts > static_cast<std::uint64_t>(INT32_MAX))
+        usage("too many operations: element ids must fit in an int");
+
+    /*
+     * Each element's value is its id, and putTime[id] holds the timestamp
+     * taken just before it was put, so a take can compute its sojourn without
+     * the container knowing anything about timing.
+     */
+    std::vector<std::uint64_t> putTime(totalPuts);
+    int nextId = 0;
+    std::uint64_t depth = 0;
+
+    const auto container = Adapter::make();
+    LatencyResult result;
+    MixSchedule schedule(options);
+
+    const auto doPut = [&](const bool measured) {
+        const int id = nextId++;
+        const std::uint64_t start = clock.now();
+        putTime[static_cast<std::size_t>(id)] = start;
+        Adapter::put(*container, id);
+        const std::uint64_t end = clock.now();
+        ++depth;
+        if (measured)
+            result.put.record(clock.toNanos(end - start));
+    };
+
+    const auto doTake = [&](const bool measured) {
+        const std::uint64_t start = clock.now();
+        const int id = Adapter::take(*container);
+        const std::uint64_t end = clock.now();
+        --depth;
+        if (measured) {
+            result.take.record(clock.toNanos(end - start));
+            result.sojourn.record(
+                clock.toNanos(end - putTime[static_cast<std::size_t>(id)]));
+        }
+    };
+
+    const auto step = [&](const bool measured) {
+        bool put = schedule.nextIsPut();
+        if (depth == 0)
+            put = true;
+        else if (depth >= options.maxDepth)
+            put = false;
+        if (put)
+            doPut(measured);
+        else
+            doTake(measured);
+    };
+
+    for (std::uint64_t i = 0; i < options.prefill; ++i) {
+        doPut(false);
+    }
+    for (std::uint64_t i = 0; i < options.warmup; ++i) {
+        step(false);
+    }
+    for (std::uint64_t i = 0; i < options.ops; ++i) {
+        step(true);
+    }
+    return result;
+}
+
+template <typename Container>
+void report(const Options& options, const BenchClock& clock) {
+    using Adapter = ContainerAdapter<Container>;
+    const LatencyResult result = runLatency<Container>(options, clock);
+
+    std::cout << "== " << Adapter::name << " ==\n"
+              << Adapter::putName << ": " << result.put.toText()
+              << Adapter::takeName << ": " << result.take.toText()
+              << Adapter::putName << "-to-" << Adapter::takeName << ": "
+              << result.sojourn.toText() << '\n';
+}
+
+struct Registration {
+    const char* name;
+    std::function<void(const Options&, const BenchClock&)> run;
+};
+
+// Add new Stack/Queue variants here (and a ContainerAdapter specialisation)
+const std::vector<Registration> registry = {
+    {ContainerAdapter<Stack>::name, report<Stack>},
+    {ContainerAdapter<Queue>::name, report<Queue>},
+    {ContainerAdapter<BlockingQueue>::name, report<BlockingQueue>},
+};
+
+} // namespace
+
+int main(const int argc, char** argv) {
+    const Options options = parseOptions(argc, argv);
+    const BenchClock clock(options.clock);
+
+    std::cout << "clock=" << clock.getName()
+              << " overhead=" << clock.overheadNanos() << "ns"
+              << " ops=" << options.ops << " mix=" << options.producers << ':'
+              << options.consumers
+              << " pattern=" << (options.randomPattern ? "random" : "round")
+              << " prefill=" << options.prefill
+              << " max-depth=" << options.maxDepth << "\n\n";
+
+    bool matched = false;
+    for (const Registration& entry : registry) {
+        if (options.container == "all" || options.container == entry.name) {
+            entry.run(options, clock);
+            matched = true;
+        }
+    }
+    if (!matched)
+        usage("unknown container " + options.container);
+    return 0;
+}
@@ -0,0 +1,192 @@
+/*
+ * Traversal cost of LinkedList / DoublyLinkedList by node layout.
+ *
+ * The same list is built three ways:
+ *   scattered  nodes handed out in random order from one big pool, like a
+ *              long-running, fragmented heap: every hop is a likely miss
+ *   malloc     plain new/delete on a fresh heap (usually close to sequential)
+ *   chunked    NodeChunkResource: nodes contiguous in traversal order
+ * and timed on get(n - 1), findKthFromEnd(n / 2), reverse() and
+ * DoublyLinkedList::get(n / 2 - 1). Use a --size well beyond the last-level
+ * cache (the default list is ~64 MB) and compare a build configured with
+ * -DENABLE_PREFETCH=OFF to see what the prefetch hints add.
+ *
+ * Usage:
+ *   traversal_bench [--size=N] [--repeat=N] [--seed=N]
+ */
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <memory_resource>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "doublylinkedlist.hpp"
+#include "linkedlist.hpp"
+#include "nodechunkresource.hpp"
+#include "prefetch.hpp"
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+struct Options {
+    int size = 4000000;
+    int repeat = 3;
+    std::uint64_t seed = 1;
+};
+
+[[noreturn]] void usage(const std::string& problem) {
+    std::cerr << "traversal_bench: " << problem << "\n"
+              << "usage: traversal_bench [--size=N] [--repeat=N] [--seed=N]\n";
+    std::exit(2);
+}
+
+int parsePositive(const std::string& text, const std::string& flag) {
+    try {
+        std::size_t used = 0;
+        const int value = std::stoi(text, &used);
+        if (used == text.size() && value > 0)
+            return value;
+    } catch (const std::exception&) {
+    }
+    usage("invalid value for " + flag + ": " + text);
+}
+
+Options parseOptions(const int argc, char** argv) {
+    Options options;
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        const std::size_t eq = arg.find('=');
+        const std::string key = arg.substr(0, eq);
+        const std::string value = eq == std::string::npos ? "" : arg.substr(eq + 1);
+
+        if (key == "--size") {
+            options.size = parsePositive(value, key);
+        } else if (key == "--repeat") {
+            options.repeat = parsePositive(value, key);
+        } else if (key == "--seed") {
+            options.seed = static_cast<std::uint64_t>(parsePositive(value, key));
+        } else {
+            usage("unknown option " + arg);
+        }
+    }
+    return options;
+}
+
+// Hands out fixed-size blocks of one big pool in a random order
+class ScatteredResource : public std::pmr::memory_resource {
+public:
+    ScatteredResource(const std::size_t blockSize, const std::size_t blocks,
+                      const std::uint64_t seed)
+        : blockSize{blockSize},
+          pool(blockSize * blocks),
+          order(blocks),
+          next{0} {
+        for (std::size_t i = 0; i < blocks; ++i) {
+            order[i] = i;
+        }
+        std::mt19937_64 rng(seed);
+        std::shuffle(order.begin(), order.end(), rng);
+    }
+
+private:
+    void* do_allocate(const std::size_t bytes, const std::size_t alignment) override {
+        if (bytes > blockSize || next == order.size())
+            return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+        return pool.data() + order[next++] * blockSize;
+    }
+
+    void do_deallocate(void* p, const std::size_t bytes, const std::size_t alignment) override {
+        auto* bytePtr = static_cast<std::byte*>(p);
+        if (bytePtr < pool.data() || bytePtr >= pool.data() + pool.size())
+            std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+    }
+
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+        return this == &other;
+    }
+
+    std::size_t blockSize;
+    std::vector<std::byte> pool;
+    std::vector<std::size_t> order;
+    std::size_t next;
+};
+
+template <typename Operation>
+double bestNanosPerNode(const Options& options, const double nodesTouched, Operation op) {
+    double best = 1e30;
+    for (int r = 0; r < options.repeat; ++r) {
+        const auto start = Clock::now();
+        op();
+        const auto nanos = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                               Clock::now() - start)
+                               .count();
+        best = std::min(best, static_cast<double>(nanos) / nodesTouched);
+    }
+    return best;
+}
+
+void runLayout(const char* name, const Options& options,
+               std::pmr::memory_resource* singly, std::pmr::memory_resource* doubly,
+               long long& checksum) {
+    const int n = options.size;
+    const double nodes = n;
+
+    LinkedList list(0, singly);
+    DoublyLinkedList dlist(0, doubly);
+    for (int i = 1; i < n; ++i) {
+        list.append(i);
+        dlist.append(i);
+    }
+
+    const double get = bestNanosPerNode(options, nodes, [&] {
+        checksum += list.get(n - 1)->getData();
+    });
+    const double kth = bestNanosPerNode(options, nodes, [&] {
+        checksum += list.findKthFromEnd(n / 2)->getData();
+    });
+    const double reverse = bestNanosPerNode(options, nodes, [&] {
+        list.reverse();
+        checksum += list.getHead()->getData();
+    });
+    const double dget = bestNanosPerNode(options, nodes / 2, [&] {
+        checksum += dlist.get(n / 2 - 1)->value;
+    });
+
+    std::cout << std::left << std::setw(10) << name << std::right << std::fixed
+              << std::setprecision(2) << std::setw(10) << get << std::setw(14) << kth
+              << std::setw(10) << reverse << std::setw(10) << dget << "\n";
+}
+
+} // namespace
+
+int main(const int argc, char** argv) {
+    const Options options = parseOptions(argc, argv);
+    const auto blocks = static_cast<std::size_t>(options.size);
+
+    std::cout << "size=" << options.size << " repeat=" << options.repeat
+              << " prefetch=" << (DS_PREFETCH_ENABLED ? "on" : "off")
+              << "   (ns per node visited, best of repeats)\n"
+              << "layout           get   findKthEnd   reverse   dl::get\n";
+
+    long long checksum = 0;
+    {
+        ScatteredResource singly(sizeof(Node), blocks, options.seed);
+        ScatteredResource doubly(sizeof(DNode), blocks, options.seed + 1);
+        runLayout("scattered", options, &singly, &doubly, checksum);
+    }
+    runLayout("malloc", options, nullptr, nullptr, checksum);
+    {
+        NodeChunkResource singly(sizeof(Node));
+        NodeChunkResource doubly(sizeof(DNode));
+        runLayout("chunked", options, &singly, &doubly, checksum);
+    }
+    std::cout << "checksum " << checksum << "\n";
+    return 0;
+}
@@ -1,213 +1,392 @@
+/*
+ * dsApp: replays a recorded workload trace against the containers.
+ *
+ * The trace (text or binary, see trace.hpp) is replayed once per selected
+ * container. Each operation is timed on its own; the report gives ops/sec,
+ * latency percentiles, and the peak memory held by the container's nodes,
+ * counted through a std::pmr resource, so implementations can be compared
+ * on a production workload before switching. Operations a container does not
+ * have (push on a Queue, say) are skipped and counted. Lists map push/pop to
+ * prepend/deleteFirst and enQueue/deQueue to append/deleteFirst.
+ *
+ * Usage:
+ *   dsApp --trace=FILE [--container=NAME[,NAME...]] [--repeat=N] [--save=FILE] [--binary]
+ *   dsApp --generate=N [--seed=N] [--container=...] [--save=FILE] [--binary]
+ *
+ * Containers: linkedlist, doublylinkedlist, stack, queue (default: all).
+ * --generate makes a random mixed trace instead of reading one; --save
+ * writes the trace out (as binary with --binary), e.g. to convert formats.
+ */
+#include <sys/resource.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
 #include <iostream>
+#include <iterator>
+#include <memory_resource>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
 
+#include "doublylinkedlist.hpp"
+#include "latencyhistogram.hpp"
+#include "linkedlist.hpp"
 #include "queue.hpp"
 #include "stack.hpp"
-#include "linkedlist.hpp"
-#include "doublylinkedlist.hpp"
+#include "trace.hpp"
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+const std::vector<std::string> kContainers{"linkedlist", "doublylinkedlist", "stack", "queue"};
+
+struct Options {
+    std::string tracePath;
+    int generate = 0;
+    std::uint64_t seed = 1;
+    std::vector<std::string> containers = kContainers;
+    int repeat = 1;
+    std::string savePath;
+    bool binary = false;
+};
+
+[[noreturn]] void usage(const std::string& problem) {
+    std::cerr << "dsApp: " << problem << "\n"
+              << "usage: dsApp --trace=FILE [--container=NAME[,NAME...]] [--repeat=N]"
+                 " [--save=FILE] [--binary]\n"
+              << "       dsApp --generate=N [--seed=N] [--container=...] [--save=FILE]"
+                 " [--binary]\n"
+              << "containers: linkedlist, doublylinkedlist, stack, queue\n";
+    std::exit(2);
+}
+
+int parsePositive(const std::string& text, const std::string& flag) {
+    try {
+        std::size_t used = 0;
+        const int value = std::stoi(text, &used);
+        if (used == text.size() && value > 0)
+            return value;
+    } catch (const std::exception&) {
+    }
+    usage("invalid value for " + flag + ": " + text);
+}
+
+std::vector<std::string> parseContainers(const std::string& text) {
+    std::vector<std::string> names;
+    std::stringstream stream(text);
+    std::string name;
+    while (std::getline(stream, name, ',')) {
+        if (std::find(kContainers.begin(), kContainers.end(), name) == kContainers.end())
+            usage("unknown container " + name);
+        names.push_back(name);
+    }
+    if (names.empty())
+        usage("no container given");
+    return names;
+}
+
+Options parseOptions(const int argc, char** argv) {
+    Options options;
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        const std::size_t eq = arg.find('=');
+        const std::string key = arg.substr(0, eq);
+        const std::string value = eq == std::string::npos ? "" : arg.substr(eq + 1);
+
+        if (key == "--trace") {
+            options.tracePath = value;
+        } else if (key == "--generate") {
+            options.generate = parsePositive(value, key);
+        } else if (key == "--seed") {
+            options.seed = static_cast<std::uint64_t>(parsePositive(value, key));
+        } else if (key == "--container") {
+            options.containers = parseContainers(value);
+        } else if (key == "--repeat") {
+            options.repeat = parsePositive(value, key);
+        } else if (key == "--save") {
+            options.savePath = value;
+        } else if (key == "--binary") {
+            options.binary = true;
+        } else {
+            usage("unknown option " + arg);
+        }
+    }
+    if (options.tracePath.empty() == (options.generate == 0))
+        usage("give exactly one of --trace and --generate");
+    return options;
+}
+
+// Random mix that keeps every container busy: grows, then hovers around a size
+Trace generateTrace(const int count, const std::uint64_t seed) {
+    static constexpr TraceOp kMix[] = {
+        TraceOp::Append, TraceOp::Prepend, TraceOp::Insert, TraceOp::Get, TraceOp::Set,
+        TraceOp::DeleteNode, TraceOp::DeleteFirst, TraceOp::DeleteLast, TraceOp::Push,
+        TraceOp::Pop, TraceOp::EnQueue, TraceOp::DeQueue,
+    };
+    std::mt19937_64 rng(seed);
+    Trace trace;
+    int approximateSize = 0;
+    for (int i = 0; i < count; ++i) {
+        // grow-heavy until there is something to index into
+        const bool grow = approximateSize < 64 && rng() % 2 == 0;
+        const TraceOp op = grow ? TraceOp::Append : kMix[rng() % std::size(kMix)];
+        const int index = static_cast<int>(rng() % static_cast<std::uint64_t>(approximateSize + 1));
+        TraceRecord record{op, 0, static_cast<int>(rng() % 1000)};
+        if (Trace::argumentCount(op) == 0)
+            record.value = 0;
+        if (op == TraceOp::Insert || op == TraceOp::Get || op == TraceOp::Set ||
+            op == TraceOp::DeleteNode)
+            record.index = index;
+        if (op == TraceOp::Get || op == TraceOp::DeleteNode)
+            record.value = 0;
+        trace.add(record);
+
+        if (op == TraceOp::Append || op == TraceOp::Prepend || op == TraceOp::Insert ||
+            op == TraceOp::Push || op == TraceOp::EnQueue) {
+            ++approximateSize;
+        } else if (op == TraceOp::DeleteNode || op == TraceOp::DeleteFirst ||
+                   op == TraceOp::DeleteLast || op == TraceOp::Pop || op == TraceOp::DeQueue) {
+            approximateSize = std::max(0, approximateSize - 1);
+        }
+    }
+    return trace;
+}
+
+// Counts the bytes a container's nodes hold, on top of the global heap
+class CountingResource : public std::pmr::memory_resource {
+public:
+    std::size_t getPeakBytes() const {
+        return peakBytes;
+    }
+
+private:
+    void* do_allocate(const std::size_t bytes, const std::size_t alignment) override {
+        currentBytes += bytes;
+        peakBytes = std::max(peakBytes, currentBytes);
+        return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+    }
 
-using namespace std;
-
-int main() {
-    // // SINGLY LINKEDLIST
-    // auto ll = new LinkedList(3);
-    // ll->append(14);
-    // ll->append(5);
-    // ll->append(28);
-    // ll->append(28);
-    // ll->append(28);
-    // ll->append(35);
-    // ll->append(1000);
-    // ll->append(4);
-    // ll->prepend(50);
-    // ll->prepend(1000);
-    // ll->prepend(1000);
-    //
-    // // partition list
-    // ll->partitionList(10);
-    // std::cout << "Partitioned LinkedList: " << *ll << '\n';
-    // std::cout << "LinkedList length: " << ll->getLength() << '\n';
-    // std::cout << "Head: " << ll->getHead()->getData() << '\n';
-    // std::cout << "Tail: " << ll->getTail()->getData() << '\n';
-    //
-    // // get
-    // cout << "Node: " << ll->get(0)->getNext()->getData() << '\n';
-    //
-    // // set
-    // ll->set(4, 77000);
-    // cout << "LinkedList length: " << ll->getLength() << '\n';
-    // cout << "LinkedList: " << *ll << '\n';
-    //
-    // // insert
-    // ll->insert(5, 999000);
-    // cout << "LinkedList length: " << ll->getLength() << '\n';
-    // cout << "LinkedList: " << *ll << '\n';
-    //
-    // // find middle node before reversal
-    // cout << "Middle Node (before reversal): " << ll->findMiddleNode()->getData() << '\n';
-    //
-    // // reverse nodes
-    // ll->reverse();
-    // cout << "LinkedList length: " << ll->getLength() << '\n';
-    // cout << "Reversed LinkedList: " << *ll << '\n';
-    //
-    // // find middle node after reversal
-    // cout << "Middle Node (after reversal): " << ll->findMiddleNode()->getData() << '\n';
-    //
-    // // check for loops in the linkedList
-    // cout << "Has Loop: " << boolalpha << ll->hasLoop() << '\n';
-    //
-    // // find the kth node
-    // cout << "3rd Node from the end: " << ll->findKthFromEnd(3)->getData() << '\n';
-    //
-    // // delete node
-    // ll->deleteNode(2);
-    // cout << "LinkedList length: " << ll->getLength() << '\n';
-    // cout << "'deleted nodes' LinkedList: " << *ll << '\n';
-    //
-    // // find middle node after deleting a node
-    // cout << "Middle Node (after deleting a node): " << ll->findMiddleNode()->getData() << '\n';
-    //
-    // // check for loops in the linkedList
-    // cout << "Has Loop: " << boolalpha << ll->hasLoop() << '\n';
-    //
-    // // find the kth node
-    // cout << "5th Node from the end: " << ll->findKthFromEnd(5)->getData() << '\n';
-    //
-    // // find and remove nodes with duplicate values
-    // ll->removeDuplicates();
-    // cout << "LinkedList length: " << ll->getLength() << '\n';
-    // cout << "'de-duplicated' LinkedList: " << *ll << '\n';
-    //
-    // // swap nodes
-    // ll->swapPairs();
-    // cout << "LinkedList length: " << ll->getLength() << '\n';
-    // cout << "'swapped' LinkedList: " << *ll << '\n';
-    //
-    // // reverse nodes in between m and n position
-    // ll->reverseBetween(2, 5);
-    // cout << "LinkedList length: " << ll->getLength() << '\n';
-    // cout << "'reversed between' LinkedList: " << *ll << '\n';
-    //
-    // // deleteFirst
-    // //    while(ll->getLength()){
-    // //        ll->deleteFirst();
-    // //        cout << "LinkedList length: " << ll->getLength() << '\n';
-    // //        cout << "LinkedList: " << *ll << '\n';
-    // //
-    // //    }
-    //
-    // //    while(ll->getLength()){
-    // //        ll->deleteLast();
-    // //        cout << "LinkedList length: " << ll->getLength() << '\n';
-    // //        cout << "LinkedList: " << *ll << '\n';
-    // //
-    // //    }
-    // //
-    // //    ll->prepend(1000);
-    // //    cout << "LinkedList length: " << ll->getLength() << '\n';
-    // //    cout << "LinkedList: " << *ll << '\n';
-    //
-    // //    for (int i=0; i<=100; i+=7){
-    // //        ll->append(i);
-    // //        cout << "LinkedList length: " << ll->getLength() << '\n';
-    // //        cout << "LinkedList: " << *ll << '\n';
-    // //    }
-    // //
-    // //    while(ll->getLength()){
-    // //        ll->deleteLast();
-    // //        cout << "LinkedList length: " << ll->getLength() << '\n';
-    // //        cout << "LinkedList: " << *ll << '\n';
-    // //
-    // //    }
-    //
-    // // DOUBLY LINKEDLIST
-    // auto dll = new DoublyLinkedList(10);
-    //
-    // std::cout << "DoublyLL Length: " << dll->getLength() << '\n';
-    // dll->display();
-    //
-    // dll->append(5);
-    // dll->append(7);
-    // dll->display();
-    // std::cout << "DoublyLL Length: " << dll->getLength() << '\n';
-    //
-    // dll->prepend(3);
-    // dll->display();
-    // std::cout << "DoublyLL Length: " << dll->getLength() << '\n';
-    //
-    // dll->deleteLast();
-    // dll->display();
-    // std::cout << "DoublyLL Length: " << dll->getLength() << '\n';
-    //
-    // dll->append(11);
-    // dll->append(12);
-    // dll->append(13);
-    // dll->display();
-    // while (dll->getLength() != 0) {
-    //     dll->deleteFirst();
-    //     dll->display();
-    // }
-    //
-    // std::cout << "Index 0: " << dll->get(0)->getData() << '\n';
-    // std::cout << "Index 1: " << dll->get(1)->getData() << '\n';
-    // std::cout << "Index (length of list - 1): " << dll->get(
-    //     dll->getLength() - 1)->getData() << '\n';
-    //
-    // dll->set(0, 111);
-    // dll->set(1, 222);
-    // dll->set(dll->getLength() - 1, 333);
-    //
-    // std::cout << "Index 0: " << dll->get(0)->getData() << '\n';
-    // std::cout << "Index 1: " << dll->get(1)->getData() << '\n';
-    // std::cout << "Index (length of list - 1): " << dll->get(
-    //     dll->getLength() - 1)->getData() << '\n';
-    //
-    // while (dll->getLength() != 0) {
-    //     dll->deleteLast();
-    //     dll->display();
-    // }
-    //
-    // dll->insertNode(0, 1690);
-    // dll->display();
-    // dll->insertNode(dll->getLength(), 1999);
-    // dll->display();
-    // dll->insertNode(dll->getLength() / 2, 18880);
-    // dll->display();
-    //
-    // dll->deleteNode(dll->getLength() / 2);
-    // dll->display();
-
-    // // Stack
-    // auto* s = new Stack(0);
-    // s->display();
-    // cout << "Stack Height: " << s->getHeight() << '\n';
-    // // cout << "Stack Top Element: " << s->getTop() << '\n';
-    //
-    // for (int i=7; i<100; i += 7) {
-    //     s->push(i);
-    //     s->display();
-    // }
-    //
-    // cout << "Peek: " << s->peek() << '\n';
-    //
-    // while (s->getHeight()) {
-    //     cout << "Popped Value: " << s->pop() << '\n';
-    //     s->display();
-    // }
-    // cout << "Peek: " << s->peek() << '\n';
-
-    // Queue
-
-    auto* q = new Queue(0);
-    q->display();
-    // q->enQueue(16);
-    // q->display();
-    for (int i = 10; i < 100; i += 10) {
-        q->enQueue(i);
-        q->display();
-    }
-    while (q->getSize()) {
-        q->deQueue();
-        q->display();
-    }
-}
\ No newline at end of file
+    void do_deallocate(void* pointer, const std::size_t bytes, const std::size_t alignment) override {
+        currentBytes -= bytes;
+        std::pmr::new_delete_resource()->deallocate(pointer, bytes, alignment);
+    }
+
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+        return this == &other;
+    }
+
+    std::size_t currentBytes = 0;
+    std::size_t peakBytes = 0;
+};
+
+/*
+ * Applies one record; false if the container has no such operation. Reads
+ * go into `sink` so the optimizer cannot drop them.
+ */
+bool apply(LinkedList& list, const TraceRecord& record, long long& sink) {
+    switch (record.op) {
+    case TraceOp::Append:
+    case TraceOp::EnQueue:
+        list.append(record.value);
+        return true;
+    case TraceOp::Prepend:
+    case TraceOp::Push:
+        list.prepend(record.value);
+        return true;
+    case TraceOp::Insert:
+        list.insert(record.index, record.value);
+        return true;
+    case TraceOp::Get:
+        if (const Node* node = list.get(record.index))
+            sink += node->getData();
+        return true;
+    case TraceOp::Set:
+        list.set(record.index, record.value);
+        return true;
+    case TraceOp::DeleteNode:
+        list.deleteNode(record.index);
+        return true;
+    case TraceOp::DeleteFirst:
+    case TraceOp::Pop:
+    case TraceOp::DeQueue:
+        list.deleteFirst();
+        return true;
+    case TraceOp::DeleteLast:
+        list.deleteLast();
+        return true;
+    case TraceOp::Clear:
+        list.clear();
+        return true;
+    }
+    return false;
+}
+
+bool apply(DoublyLinkedList& list, const TraceRecord& record, long long& sink) {
+    switch (record.op) {
+    case TraceOp::Append:
+    case TraceOp::EnQueue:
+        list.append(record.value);
+        return true;
+    case TraceOp::Prepend:
+    case TraceOp::Push:
+        list.prepend(record.value);
+        return true;
+    case TraceOp::Insert:
+        list.insertNode(record.index, record.value);
+        return true;
+    case TraceOp::Get:
+        if (const DNode* node = list.get(record.index))
+            sink += node->getData();
+        return true;
+    case TraceOp::Set:
+        list.set(record.index, record.value);
+        return true;
+    case TraceOp::DeleteNode:
+        list.deleteNode(record.index);
+        return true;
+    case TraceOp::DeleteFirst:
+    case TraceOp::Pop:
+    case TraceOp::DeQueue:
+        list.deleteFirst();
+        return true;
+    case TraceOp::DeleteLast:
+        list.deleteLast();
+        return true;
+    case TraceOp::Clear:
+        list.clear();
+        return true;
+    }
+    return false;
+}
+
+bool apply(Stack& stack, const TraceRecord& record, long long& sink) {
+    switch (record.op) {
+    case TraceOp::Push:
+        stack.push(record.value);
+        return true;
+    case TraceOp::Pop:
+        sink += stack.pop();
+        return true;
+    case TraceOp::Clear:
+        stack.clear();
+        return true;
+    default:
+        return false;
+    }
+}
+
+bool apply(Queue& queue, const TraceRecord& record, long long& sink) {
+    switch (record.op) {
+    case TraceOp::EnQueue:
+        queue.enQueue(record.value);
+        return true;
+    case TraceOp::DeQueue:
+        sink += queue.deQueue();
+        return true;
+    case TraceOp::Clear:
+        queue.clear();
+        return true;
+    default:
+        return false;
+    }
+}
+
+struct ReplayResult {
+    long long replayed = 0;
+    long long skipped = 0;
+    double seconds = 0.0;
+    std::size_t peakBytes = 0;
+    LatencyHistogram latency;
+};
+
+template <typename Container>
+ReplayResult replay(const Trace& trace, const int repeat, long long& sink) {
+    ReplayResult result;
+    for (int round = 0; round < repeat; ++round) {
+        CountingResource resource;
+        {
+            const auto container = std::make_unique<Container>(&resource);
+            for (const TraceRecord& record : trace.getRecords()) {
+                const auto start = Clock::now();
+                const bool applied = apply(*container, record, sink);
+                const auto elapsed = Clock::now() - start;
+                if (!applied) {
+                    ++result.skipped;
+                    continue;
+                }
+                ++result.replayed;
+                result.seconds += std::chrono::duration<double>(elapsed).count();
+                result.latency.record(static_cast<std::uint64_t>(
+                    std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()));
+            }
+        }
+        result.peakBytes = std::max(result.peakBytes, resource.getPeakBytes());
+    }
+    return result;
+}
+
+ReplayResult replayNamed(const std::string& name, const Trace& trace, const int repeat, long long& sink) {
+    if (name == "linkedlist")
+        return replay<LinkedList>(trace, repeat, sink);
+    if (name == "doublylinkedlist")
+        return replay<DoublyLinkedList>(trace, repeat, sink);
+    if (name == "stack")
+        return replay<Stack>(trace, repeat, sink);
+    return replay<Queue>(trace, repeat, sink);
+}
+
+long peakRssKiB() {
+    rusage usage{};
+    getrusage(RUSAGE_SELF, &usage);
+#ifdef __APPLE__
+    return usage.ru_maxrss / 1024; // bytes on macOS
+#else
+    return usage.ru_maxrss; // KiB on Linux
+#endif
+}
+
+} // namespace
+
+int main(const int argc, char** argv) {
+    const Options options = parseOptions(argc, argv);
+
+    Trace trace;
+    std::string error;
+    if (options.generate > 0) {
+        trace = generateTrace(options.generate, options.seed);
+    } else if (!trace.loadFile(options.tracePath, error)) {
+        std::cerr << "dsApp: " << options.tracePath << ": " << error << "\n";
+        return 1;
+    }
+    if (!options.savePath.empty() && !trace.saveFile(options.savePath, options.binary, error)) {
+        std::cerr << "dsApp: " << error << "\n";
+        return 1;
+    }
+
+    std::cout << "trace: " << trace.getSize() << " ops"
+              << (options.generate > 0 ? " (generated)" : "") << ", repeat=" << options.repeat
+              << "   (latency in ns, timed per operation)\n"
+              << "container          replayed   skipped     Mops/s  peak KiB"
+                 "     p50     p99   p99.9      max\n";
+    long long sink = 0;
+    for (const std::string& name : options.containers) {
+        const ReplayResult result = replayNamed(name, trace, options.repeat, sink);
+        const double mops =
+            result.seconds > 0.0 ? static_cast<double>(result.replayed) / result.seconds / 1e6 : 0.0;
+        std::cout << std::left << std::setw(17) << name << std::right << std::setw(10)
+                  << result.replayed << std::setw(10) << result.skipped << std::fixed
+                  << std::setprecision(2) << std::setw(11) << mops << std::setw(10)
+                  << (result.peakBytes + 1023) / 1024 << std::setw(8)
+                  << result.latency.valueAtPercentile(50) << std::setw(8)
+                  << result.latency.valueAtPercentile(99) << std::setw(8)
+                  << result.latency.valueAtPercentile(99.9) << std::setw(9)
+                  << result.latency.getMax() << "\n";
+    }
+    std::cout << "process peak RSS: " << peakRssKiB() << " KiB (checksum " << sink << ")\n";
+    return 0;
+}
@@ -0,0 +1,79 @@
+#include "asyncqueue.hpp"
+
+#include <climits>
+
+// PopAwaiter
+
+AsyncQueue::PopAwaiter::PopAwaiter(AsyncQueue& queue)
+    : queue{&queue},
+      value{INT_MIN} {
+}
+
+AsyncQueue::PopAwaiter::~PopAwaiter() {
+    if (isLinked())
+        queue->waiters.erase(*this);
+}
+
+bool AsyncQueue::PopAwaiter::await_ready() {
+    // values only pile up while nobody waits, so taking one here keeps FIFO
+    if (queue->values.getSize() > 0) {
+        value = queue->values.deQueue();
+        return true;
+    }
+    return queue->closed;
+}
+
+void AsyncQueue::PopAwaiter::await_suspend(const std::coroutine_handle<> handle) {
+    waiter = handle;
+    queue->waiters.append(*this);
+}
+
+int AsyncQueue::PopAwaiter::await_resume() const {
+    return value;
+}
+
+// AsyncQueue
+
+AsyncQueue::AsyncQueue()
+    : closed{false} {
+}
+
+AsyncQueue::~AsyncQueue() = default;
+
+bool AsyncQueue::enQueue(const int value) {
+    if (closed)
+        return false;
+    if (PopAwaiter* waiting = waiters.popFront()) {
+        waiting->value = value;
+        waiting->waiter.resume();
+        return true;
+    }
+    values.enQueue(value);
+    return true;
+}
+
+AsyncQueue::PopAwaiter AsyncQueue::deQueue() {
+    return PopAwaiter(*this);
+}
+
+void AsyncQueue::close() {
+    closed = true;
+    while (PopAwaiter* waiting = waiters.popFront()) {
+        waiting->value = INT_MIN;
+        waiting->waiter.resume();
+    }
+}
+
+// Accessors
+
+int AsyncQueue::getSize() const {
+    return values.getSize();
+}
+
+int AsyncQueue::getWaiterCount() const {
+    return waiters.getLength();
+}
+
+bool AsyncQueue::isClosed() const {
+    return closed;
+}
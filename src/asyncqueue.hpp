@@ -0,0 +1,63 @@
+#pragma once
+
+#include <coroutine>
+
+#include "intrusivelist.hpp"
+#include "queue.hpp"
+
+/*
+ * FIFO of ints for coroutines: `co_await queue.deQueue()` suspends while the
+ * queue is empty, and enQueue() hands its value straight to the longest
+ * waiting consumer and resumes it before returning. No thread, poll or
+ * condition variable per consumer: a waiter is one awaiter object in its
+ * coroutine frame, linked into an IntrusiveList, so thousands of them cost
+ * no allocation beyond their frames.
+ *
+ * Single-threaded: every call and every awaiting coroutine must run on one
+ * thread (typically a CoroExecutor's). Because enQueue() and close() resume
+ * consumers inline, the consumer runs on the producer's stack until it next
+ * suspends.
+ */
+class AsyncQueue {
+public:
+    class PopAwaiter : public ListHook<> {
+    public:
+        PopAwaiter(const PopAwaiter&) = delete;
+        PopAwaiter& operator=(const PopAwaiter&) = delete;
+        ~PopAwaiter(); // a destroyed waiting coroutine leaves the queue
+
+        bool await_ready();
+        void await_suspend(std::coroutine_handle<> handle);
+        int await_resume() const; // INT_MIN once the queue is closed and drained
+
+    private:
+        friend class AsyncQueue;
+
+        explicit PopAwaiter(AsyncQueue& queue);
+
+        AsyncQueue* queue;
+        std::coroutine_handle<> waiter;
+        int value;
+    };
+
+    AsyncQueue();
+    ~AsyncQueue(); // coroutines still waiting stay suspended, unlinked
+
+    AsyncQueue(const AsyncQueue&) = delete;
+    AsyncQueue& operator=(const AsyncQueue&) = delete;
+
+    // 🚀 APIs
+    bool enQueue(int value); // false once the queue is closed
+    PopAwaiter deQueue(); // co_await queue.deQueue()
+    void close(); // resumes every waiter with INT_MIN; values left can still be taken
+
+    // 👀 Accessors
+    int getSize() const; // values waiting for a consumer
+    int getWaiterCount() const; // consumers waiting for a value
+    bool isClosed() const;
+
+private:
+    Queue values;
+    IntrusiveList<PopAwaiter> waiters;
+    bool closed;
+};
@@ -0,0 +1,198 @@
+#include "blockingqueue.hpp"
+
+#include <algorithm>
+#include <climits>
+
+BlockingQueue::BlockingQueue(const int capacity)
+    // a zero-capacity queue could never accept anything, so keep at least one slot
+    : slots(static_cast<std::size_t>(std::max(capacity, 1))),
+      head{0},
+      size{0},
+      waitingConsumers{0},
+      waitingProducers{0},
+      closed{false} {
+}
+
+void BlockingQueue::pushLocked(const int value) {
+    const int capacity = static_cast<int>(slots.size());
+    slots[static_cast<std::size_t>((head + size) % capacity)] = value;
+    ++size;
+}
+
+int BlockingQueue::popLocked() {
+    const int value = slots[static_cast<std::size_t>(head)];
+    head = (head + 1) % static_cast<int>(slots.size());
+    --size;
+    return value;
+}
+
+void BlockingQueue::afterPush(const int sizeBefore) {
+    /*
+     * Consumers only sleep on an empty queue, so only the empty -> non-empty
+     * transition can have someone to wake. If more work remains once that
+     * consumer is up, afterPop() hands the signal on to the next one.
+     */
+    if (sizeBefore == 0 && size > 0 && waitingConsumers > 0) {
+        notEmpty.notify_one();
+    }
+    // we may have been woken for room that we did not use up
+    if (size < getCapacity() && waitingProducers > 0) {
+        notFull.notify_one();
+    }
+}
+
+void BlockingQueue::afterPop(const int sizeBefore) {
+    if (sizeBefore == getCapacity() && size < getCapacity() && waitingProducers > 0) {
+        notFull.notify_one();
+    }
+    if (size > 0 && waitingConsumers > 0) {
+        notEmpty.notify_one();
+    }
+}
+
+bool BlockingQueue::push(const int value) {
+    std::unique_lock lock(mutex);
+    ++waitingProducers;
+    notFull.wait(lock, [this] { return closed || size < getCapacity(); });
+    --waitingProducers;
+    if (closed)
+        return false;
+
+    const int sizeBefore = size;
+    pushLocked(value);
+    afterPush(sizeBefore);
+    return true;
+}
+
+bool BlockingQueue::tryPush(const int value, const std::chrono::milliseconds timeout) {
+    std::unique_lock lock(mutex);
+    ++waitingProducers;
+    const bool ready = notFull.wait_for(
+        lock, timeout, [this] { return closed || size < getCapacity(); });
+    --waitingProducers;
+    if (!ready || closed)
+        return false;
+
+    const int sizeBefore = size;
+    pushLocked(value);
+    afterPush(sizeBefore);
+    return true;
+}
+
+int BlockingQueue::pop() {
+    std::unique_lock lock(mutex);
+    ++waitingConsumers;
+    notEmpty.wait(lock, [this] { return closed || size > 0; });
+    --waitingConsumers;
+    if (size == 0)
+        return INT_MIN;
+
+    const int sizeBefore = size;
+    const int value = popLocked();
+    afterPop(sizeBefore);
+    return value;
+}
+
+bool BlockingQueue::tryPop(int& value, const std::chrono::milliseconds timeout) {
+    std::unique_lock lock(mutex);
+    ++waitingConsumers;
+    notEmpty.wait_for(lock, timeout, [this] { return closed || size > 0; });
+    --waitingConsumers;
+    if (size == 0)
+        return false;
+
+    const int sizeBefore = size;
+    value = popLocked();
+    afterPop(sizeBefore);
+    return true;
+}
+
+int BlockingQueue::pushBatch(const std::vector<int>& values) {
+    std::unique_lock lock(mutex);
+    int pushed = 0;
+    const int total = static_cast<int>(values.size());
+
+    while (pushed < total) {
+        ++waitingProducers;
+        notFull.wait(lock, [this] { return closed || size < getCapacity(); });
+        --waitingProducers;
+        if (closed)
+            break;
+
+        // fill all the room there is before waking anyone
+        const int sizeBefore = size;
+        const int room = getCapacity() - size;
+        const int chunk = std::min(room, total - pushed);
+        for (int i = 0; i < chunk; ++i) {
+            pushLocked(values[static_cast<std::size_t>(pushed + i)]);
+        }
+        pushed += chunk;
+        afterPush(sizeBefore);
+    }
+    return pushed;
+}
+
+int BlockingQueue::popBatch(std::vector<int>& out, const int maxCount) {
+    if (maxCount <= 0)
+        return 0;
+
+    std::unique_lock lock(mutex);
+    ++waitingConsumers;
+    notEmpty.wait(lock, [this] { return closed || size > 0; });
+    --waitingConsumers;
+
+    const int sizeBefore = size;
+    const int taken = std::min(size, maxCount);
+    for (int i = 0; i < taken; ++i) {
+        out.push_back(popLocked());
+    }
+    if (taken > 0)
+        afterPop(sizeBefore);
+    return taken;
+}
+
+int BlockingQueue::tryPopBatch(
+    std::vector<int>& out,
+    const int maxCount,
+    const std::chrono::milliseconds timeout) {
+    if (maxCount <= 0)
+        return 0;
+
+    std::unique_lock lock(mutex);
+    ++waitingConsumers;
+    notEmpty.wait_for(lock, timeout, [this] { return closed || size > 0; });
+    --waitingConsumers;
+
+    const int sizeBefore = size;
+    const int taken = std::min(size, maxCount);
+    for (int i = 0; i < taken; ++i) {
+        out.push_back(popLocked());
+    }
+    if (taken > 0)
+        afterPop(sizeBefore);
+    return taken;
+}
+
+void BlockingQueue::close() {
+    {
+        std::lock_guard lock(mutex);
+        closed = true;
+    }
+    notEmpty.notify_all();
+    notFull.notify_all();
+}
+
+int BlockingQueue::getSize() const {
+    std::lock_guard lock(mutex);
+    return size;
+}
+
+int BlockingQueue::getCapacity() const {
+    // fixed at construction, so no lock needed
+    return static_cast<int>(slots.size());
+}
+
+bool BlockingQueue::isClosed() const {
+    std::lock_guard lock(mutex);
+    return closed;
+}
@@ -0,0 +1,75 @@
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <vector>
+
+/*
+ * Bounded, blocking FIFO of ints for producer/consumer threads.
+ *
+ * Elements live in a fixed ring buffer sized at construction, so push/pop
+ * never allocate. push() waits while the queue is full, pop() waits while it
+ * is empty; the try* variants give up after a timeout. close() wakes
+ * everybody: pushes fail from then on, pops drain what is left and then
+ * report the queue as finished.
+ *
+ * Wake-ups are kept to a minimum: a producer only signals when the queue goes
+ * from empty to non-empty (and only if a consumer is actually waiting), so a
+ * consumer that drains with popBatch() is woken once per batch rather than
+ * once per element. A woken waiter passes the signal on when it leaves work
+ * behind, so several waiting consumers still all get going.
+ */
+class BlockingQueue {
+public:
+    explicit BlockingQueue(int capacity);
+
+    BlockingQueue(const BlockingQueue&) = delete;
+    BlockingQueue& operator=(const BlockingQueue&) = delete;
+
+    // 🚀 Single-element APIs
+    bool push(int value); // false once the queue is closed
+    bool tryPush(int value, std::chrono::milliseconds timeout);
+    int pop(); // uses INT_MIN as sentinel value once closed and drained
+    bool tryPop(int& value, std::chrono::milliseconds timeout);
+
+    // 📦 Batch APIs: one lock and at most one wake-up per call
+    /*
+     * Pushes every value, waiting for room as needed. Returns how many were
+     * pushed, which is less than values.size() only if the queue was closed.
+     */
+    int pushBatch(const std::vector<int>& values);
+    /*
+     * Waits until at least one element is available, then moves up to
+     * maxCount of them onto the back of `out`. Returns how many were taken;
+     * 0 means the queue is closed and empty.
+     */
+    int popBatch(std::vector<int>& out, int maxCount);
+    // Like popBatch(), but returns 0 if nothing arrives within the timeout
+    int tryPopBatch(std::vector<int>& out, int maxCount,
+                    std::chrono::milliseconds timeout);
+
+    void close();
+
+    // 👀 Accessors
+    int getSize() const;
+    int getCapacity() const;
+    bool isClosed() const;
+
+private:
+    void pushLocked(int value);
+    int popLocked();
+    // Signal the other side after a change; called with the lock held
+    void afterPush(int sizeBefore);
+    void afterPop(int sizeBefore);
+
+    mutable std::mutex mutex;
+    std::condition_variable notEmpty;
+    std::condition_variable notFull;
+    std::vector<int> slots;
+    int head; // index of the oldest element
+    int size;
+    int waitingConsumers;
+    int waitingProducers;
+    bool closed;
+};
@@ -0,0 +1,230 @@
+#include "concurrentdoublylinkedlist.hpp"
+
+#include <climits>
+#include <thread>
+
+ConcurrentDoublyLinkedList::CNode::CNode(const int value)
+    : value{value},
+      next{nullptr},
+      prev{nullptr} {
+}
+
+ConcurrentDoublyLinkedList::ConcurrentDoublyLinkedList()
+    : head(INT_MIN),
+      tail(INT_MIN),
+      length{0} {
+    head.next = &tail;
+    tail.prev = &head;
+}
+
+ConcurrentDoublyLinkedList::ConcurrentDoublyLinkedList(const int value)
+    : ConcurrentDoublyLinkedList() {
+    append(value);
+}
+
+ConcurrentDoublyLinkedList::~ConcurrentDoublyLinkedList() {
+    CNode* node = head.next;
+    while (node != &tail) {
+        CNode* next = node->next;
+        delete node;
+        node = next;
+    }
+}
+
+// Locking helpers
+
+ConcurrentDoublyLinkedList::CNode* ConcurrentDoublyLinkedList::lockPredecessor(
+    const int index) const {
+    if (index < 0)
+        return nullptr;
+    CNode* current = &head;
+    current->lock.lock();
+    for (int i = 0; i < index; ++i) {
+        CNode* next = current->next;
+        if (next == &tail) {
+            current->lock.unlock();
+            return nullptr;
+        }
+        next->lock.lock(); // take the next lock before letting go of this one
+        current->lock.unlock();
+        current = next;
+    }
+    return current;
+}
+
+ConcurrentDoublyLinkedList::CNode* ConcurrentDoublyLinkedList::lockLast() {
+    /*
+     * Locking tail first and then its predecessor runs against the
+     * front-to-back order, so the second lock is only tried: if a forward
+     * walker holds it (and may be waiting for tail), we step back and retry.
+     * While we hold tail, tail.prev cannot be unlinked (that needs tail's
+     * lock), so the node we try is never freed under us.
+     */
+    while (true) {
+        tail.lock.lock();
+        CNode* last = tail.prev;
+        if (last->lock.try_lock())
+            return last;
+        tail.lock.unlock();
+        std::this_thread::yield();
+    }
+}
+
+// APIs
+
+void ConcurrentDoublyLinkedList::append(const int value) {
+    auto* node = new CNode(value);
+    CNode* last = lockLast();
+    node->prev = last;
+    node->next = &tail;
+    last->next = node;
+    tail.prev = node;
+    length.fetch_add(1, std::memory_order_relaxed);
+    tail.lock.unlock();
+    last->lock.unlock();
+}
+
+void ConcurrentDoublyLinkedList::prepend(const int value) {
+    insertNode(0, value);
+}
+
+bool ConcurrentDoublyLinkedList::deleteLast() {
+    while (true) {
+        CNode* last = lockLast();
+        if (last == &head) {
+            tail.lock.unlock();
+            head.lock.unlock();
+            return false;
+        }
+        // last's predecessor cannot go away while we hold `last`
+        CNode* pred = last->prev;
+        if (!pred->lock.try_lock()) {
+            tail.lock.unlock();
+            last->lock.unlock();
+            std::this_thread::yield();
+            continue;
+        }
+        pred->next = &tail;
+        tail.prev = pred;
+        length.fetch_sub(1, std::memory_order_relaxed);
+        tail.lock.unlock();
+        last->lock.unlock();
+        pred->lock.unlock();
+        delete last;
+        return true;
+    }
+}
+
+bool ConcurrentDoublyLinkedList::deleteFirst() {
+    return deleteNode(0);
+}
+
+int ConcurrentDoublyLinkedList::get(const int index) const {
+    CNode* pred = lockPredecessor(index);
+    if (pred == nullptr)
+        return INT_MIN;
+    CNode* node = pred->next;
+    if (node == &tail) {
+        pred->lock.unlock();
+        return INT_MIN;
+    }
+    const std::lock_guard<std::mutex> guard(node->lock);
+    pred->lock.unlock();
+    return node->value;
+}
+
+bool ConcurrentDoublyLinkedList::set(const int index, const int newValue) {
+    CNode* pred = lockPredecessor(index);
+    if (pred == nullptr)
+        return false;
+    CNode* node = pred->next;
+    if (node == &tail) {
+        pred->lock.unlock();
+        return false;
+    }
+    const std::lock_guard<std::mutex> guard(node->lock);
+    pred->lock.unlock();
+    node->value = newValue;
+    return true;
+}
+
+bool ConcurrentDoublyLinkedList::insertNode(const int index, const int value) {
+    CNode* pred = lockPredecessor(index);
+    if (pred == nullptr)
+        return false;
+    CNode* succ = pred->next;
+    succ->lock.lock();
+
+    auto* node = new CNode(value);
+    node->prev = pred;
+    node->next = succ;
+    pred->next = node;
+    succ->prev = node;
+    length.fetch_add(1, std::memory_order_relaxed);
+
+    succ->lock.unlock();
+    pred->lock.unlock();
+    return true;
+}
+
+bool ConcurrentDoublyLinkedList::deleteNode(const int index) {
+    /*
+     * Holding predecessor, victim and successor makes the unlink atomic to
+     * everyone else. Once they are released nobody can be waiting for the
+     * victim: a forward walker would have to hold the predecessor to reach
+     * it, and lockLast() only tries a lock while holding the successor.
+     */
+    CNode* pred = lockPredecessor(index);
+    if (pred == nullptr)
+        return false;
+    CNode* victim = pred->next;
+    if (victim == &tail) {
+        pred->lock.unlock();
+        return false;
+    }
+    victim->lock.lock();
+    CNode* succ = victim->next;
+    succ->lock.lock();
+
+    pred->next = succ;
+    succ->prev = pred;
+    length.fetch_sub(1, std::memory_order_relaxed);
+
+    succ->lock.unlock();
+    victim->lock.unlock();
+    pred->lock.unlock();
+    delete victim;
+    return true;
+}
+
+// Accessors
+
+int ConcurrentDoublyLinkedList::getLength() const {
+    return length.load(std::memory_order_relaxed);
+}
+
+std::vector<int> ConcurrentDoublyLinkedList::toVector() const {
+    std::vector<int> values;
+    CNode* current = &head;
+    current->lock.lock();
+    while (current->next != &tail) {
+        CNode* next = current->next;
+        next->lock.lock();
+        current->lock.unlock();
+        current = next;
+        values.push_back(current->value);
+    }
+    current->lock.unlock();
+    return values;
+}
+
+bool ConcurrentDoublyLinkedList::isConsistent() const {
+    int count = 0;
+    for (const CNode* node = &head; node != &tail; node = node->next) {
+        if (node->next == nullptr || node->next->prev != node)
+            return false;
+        if (node != &head)
+            ++count;
+    }
+    return count == getLength();
+}
@@ -0,0 +1,75 @@
+#pragma once
+
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+/*
+ * Thread-safe doubly linked list with one mutex per node (hand-over-hand
+ * locking, a.k.a. lock coupling).
+ *
+ * A traversal holds at most two adjacent locks at a time: it locks the next
+ * node before releasing the current one, so no other thread can unlink or
+ * insert next to the node it is standing on. An edit locks exactly the nodes
+ * whose links it changes (predecessor, victim, successor), so threads working
+ * on different parts of the list run in parallel, where a single mutex would
+ * serialize them.
+ *
+ * Deadlock freedom: locks are always taken front to back. The two operations
+ * that start at the tail (append, deleteLast) take the locks behind them with
+ * try_lock and back off on failure.
+ *
+ * Index-based calls are linearizable but, with other threads editing, an
+ * index refers to the position at the moment the walk gets there. Sentinel
+ * nodes at both ends mean an edit never has to touch a shared head/tail
+ * pointer.
+ */
+class ConcurrentDoublyLinkedList {
+public:
+    ConcurrentDoublyLinkedList(); // empty list
+    explicit ConcurrentDoublyLinkedList(int value);
+    ~ConcurrentDoublyLinkedList(); // no other thread may be using the list
+
+    ConcurrentDoublyLinkedList(const ConcurrentDoublyLinkedList&) = delete;
+    ConcurrentDoublyLinkedList& operator=(const ConcurrentDoublyLinkedList&) = delete;
+
+    // 🚀 APIs, safe to call from any number of threads
+    void append(int value);
+    void prepend(int value);
+    bool deleteLast(); // false if the list was empty
+    bool deleteFirst(); // false if the list was empty
+    int get(int index) const; // uses INT_MIN as sentinel value
+    bool set(int index, int newValue);
+    bool insertNode(int index, int value); // valid index range: [0, length]
+    bool deleteNode(int index);
+
+    // 👀 Accessors
+    int getLength() const;
+    std::vector<int> toVector() const; // a consistent front-to-back walk
+
+    // Forward and backward links agree and match the length. Only meaningful
+    // while no other thread is editing the list.
+    bool isConsistent() const;
+
+private:
+    struct CNode {
+        explicit CNode(int value);
+
+        int value;
+        CNode* next;
+        CNode* prev;
+        mutable std::mutex lock;
+    };
+
+    // Walks to the node just before position `index` (the head sentinel for
+    // 0) and returns it locked, or nullptr if the list is too short
+    CNode* lockPredecessor(int index) const;
+
+    // Locks the last real node and the tail sentinel (in that order of
+    // links); returns the last node, or the head sentinel if empty
+    CNode* lockLast();
+
+    mutable CNode head; // sentinels: never removed, values unused
+    mutable CNode tail;
+    std::atomic<int> length;
+};
@@ -0,0 +1,31 @@
+#include "containerstats.hpp"
+
+#include <sstream>
+
+std::string StatsSnapshot::toText() const {
+    std::ostringstream out;
+    out << "inserts:         " << inserts << '\n'
+        << "removals:        " << removals << '\n'
+        << "lookups:         " << lookups << '\n'
+        << "nodes traversed: " << nodesTraversed << '\n'
+        << "allocations:     " << allocations << '\n'
+        << "deallocations:   " << deallocations << '\n'
+        << "bytes allocated: " << bytesAllocated << '\n'
+        << "bytes freed:     " << bytesFreed << '\n'
+        << "empty removals:  " << emptyRemovals << '\n'
+        << "high-water mark: " << highWaterMark << '\n';
+    return out.str();
+}
+
+std::string StatsSnapshot::toJson() const {
+    std::ostringstream out;
+    out << "{\"inserts\":" << inserts << ",\"removals\":" << removals
+        << ",\"lookups\":" << lookups << ",\"nodesTraversed\":" << nodesTraversed
+        << ",\"allocations\":" << allocations
+        << ",\"deallocations\":" << deallocations
+        << ",\"bytesAllocated\":" << bytesAllocated
+        << ",\"bytesFreed\":" << bytesFreed
+        << ",\"emptyRemovals\":" << emptyRemovals
+        << ",\"highWaterMark\":" << highWaterMark << "}";
+    return out.str();
+}
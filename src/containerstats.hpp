@@ -0,0 +1,114 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+/*
+ * Opt-in usage counters for LinkedList, DoublyLinkedList, Stack and Queue.
+ *
+ * Build with -DENABLE_CONTAINER_STATS=ON to turn them on. When they are off,
+ * every record*() call is an empty inline function and the ContainerStats
+ * member is an empty [[no_unique_address]] object, so the containers compile
+ * to exactly what they were before: no extra bytes, no extra instructions.
+ */
+#ifndef CONTAINER_STATS_ENABLED
+#define CONTAINER_STATS_ENABLED 0
+#endif
+
+// A point-in-time copy of a container's counters
+struct StatsSnapshot {
+    std::uint64_t inserts = 0;
+    std::uint64_t removals = 0;
+    std::uint64_t lookups = 0;
+    std::uint64_t nodesTraversed = 0; // next/prev hops taken by index lookups
+    std::uint64_t allocations = 0;
+    std::uint64_t deallocations = 0;
+    std::uint64_t bytesAllocated = 0;
+    std::uint64_t bytesFreed = 0;
+    std::uint64_t emptyRemovals = 0; // delete/pop/deQueue on an empty container
+    std::uint64_t highWaterMark = 0; // largest length ever reached
+
+    std::string toText() const;
+    std::string toJson() const;
+};
+
+class ContainerStats {
+public:
+    static constexpr bool enabled = CONTAINER_STATS_ENABLED != 0;
+
+#if CONTAINER_STATS_ENABLED
+    void recordInsert(const int lengthAfter) {
+        ++data.inserts;
+        recordLength(lengthAfter);
+    }
+
+    void recordLength(const int length) {
+        if (static_cast<std::uint64_t>(length) > data.highWaterMark) {
+            data.highWaterMark = static_cast<std::uint64_t>(length);
+        }
+    }
+
+    void recordRemoval() {
+        ++data.removals;
+    }
+
+    void recordEmptyRemoval() {
+        ++data.emptyRemovals;
+    }
+
+    void recordLookup(const int nodesTraversed) {
+        ++data.lookups;
+        data.nodesTraversed += static_cast<std::uint64_t>(nodesTraversed);
+    }
+
+    void recordTraversal(const int nodesTraversed) {
+        data.nodesTraversed += static_cast<std::uint64_t>(nodesTraversed);
+    }
+
+    void recordAllocation(const std::size_t bytes) {
+        ++data.allocations;
+        data.bytesAllocated += bytes;
+    }
+
+    void recordDeallocation(const std::size_t bytes) {
+        ++data.deallocations;
+        data.bytesFreed += bytes;
+    }
+
+    StatsSnapshot snapshot() const {
+        return data;
+    }
+
+    void reset() {
+        data = StatsSnapshot{};
+    }
+
+private:
+    StatsSnapshot data;
+#else
+    void recordInsert(int) {
+    }
+    void recordLength(int) {
+    }
+    void recordRemoval() {
+    }
+    void recordEmptyRemoval() {
+    }
+    void recordLookup(int) {
+    }
+    void recordTraversal(int) {
+    }
+    void recordAllocation(std::size_t) {
+    }
+    void recordDeallocation(std::size_t) {
+    }
+
+    StatsSnapshot snapshot() const {
+        return StatsSnapshot{};
+    }
+
+    void reset() {
+    }
+#endif
+};
@@ -0,0 +1,93 @@
+#include "coroexecutor.hpp"
+
+#include <algorithm>
+#include <utility>
+
+// CoroTask
+
+CoroTask::CoroTask(const std::coroutine_handle<promise_type> handle)
+    : handle{handle} {
+}
+
+CoroTask::CoroTask(CoroTask&& other) noexcept
+    : handle{std::exchange(other.handle, nullptr)} {
+}
+
+CoroTask& CoroTask::operator=(CoroTask&& other) noexcept {
+    if (this != &other) {
+        if (handle)
+            handle.destroy();
+        handle = std::exchange(other.handle, nullptr);
+    }
+    return *this;
+}
+
+CoroTask::~CoroTask() {
+    if (handle)
+        handle.destroy();
+}
+
+// CoroExecutor
+
+CoroExecutor::YieldAwaiter::YieldAwaiter(CoroExecutor& executor)
+    : executor{&executor} {
+}
+
+void CoroExecutor::YieldAwaiter::await_suspend(const std::coroutine_handle<> handle) const {
+    executor->ready.push_back(handle);
+}
+
+CoroExecutor::~CoroExecutor() {
+    for (const auto handle : tasks) {
+        handle.destroy();
+    }
+}
+
+void CoroExecutor::spawn(CoroTask task) {
+    const auto handle = std::exchange(task.handle, nullptr);
+    tasks.push_back(handle);
+    ready.push_back(handle);
+}
+
+CoroExecutor::YieldAwaiter CoroExecutor::yield() {
+    return YieldAwaiter(*this);
+}
+
+int CoroExecutor::run() {
+    int resumed = 0;
+    while (!ready.empty()) {
+        const std::coroutine_handle<> handle = ready.front();
+        ready.pop_front();
+        handle.resume();
+        ++resumed;
+    }
+    reap();
+    return resumed;
+}
+
+void CoroExecutor::reap() {
+    std::exception_ptr failure;
+    const auto finished = std::stable_partition(tasks.begin(), tasks.end(), [](const auto handle) {
+        return !handle.done();
+    });
+    for (auto it = finished; it != tasks.end(); ++it) {
+        if (!failure)
+            failure = it->promise().exception;
+        it->destroy();
+    }
+    tasks.erase(finished, tasks.end());
+    if (failure)
+        std::rethrow_exception(failure);
+}
+
+// Accessors
+
+int CoroExecutor::getTaskCount() const {
+    return static_cast<int>(std::count_if(tasks.begin(), tasks.end(), [](const auto handle) {
+        return !handle.done();
+    }));
+}
+
+int CoroExecutor::getReadyCount() const {
+    return static_cast<int>(ready.size());
+}
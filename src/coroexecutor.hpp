@@ -0,0 +1,113 @@
+#pragma once
+
+#include <coroutine>
+#include <deque>
+#include <exception>
+#include <vector>
+
+class CoroExecutor;
+
+/*
+ * Fire-and-forget coroutine handed to a CoroExecutor:
+ *
+ *     CoroTask consume(AsyncQueue& queue, int& sum) {
+ *         for (int value; (value = co_await queue.deQueue()) != INT_MIN;)
+ *             sum += value;
+ *     }
+ *
+ *     executor.spawn(consume(queue, sum));
+ *
+ * The body does not start until the executor runs it. A CoroTask that is
+ * never spawned destroys its coroutine unstarted.
+ */
+class CoroTask {
+public:
+    struct promise_type {
+        CoroTask get_return_object() {
+            return CoroTask(std::coroutine_handle<promise_type>::from_promise(*this));
+        }
+        std::suspend_always initial_suspend() noexcept {
+            return {};
+        }
+        // Stay suspended at the end so the executor can reap the frame
+        std::suspend_always final_suspend() noexcept {
+            return {};
+        }
+        void return_void() {
+        }
+        void unhandled_exception() {
+            exception = std::current_exception();
+        }
+
+        std::exception_ptr exception;
+    };
+
+    CoroTask(CoroTask&& other) noexcept;
+    CoroTask& operator=(CoroTask&& other) noexcept;
+    ~CoroTask();
+
+    CoroTask(const CoroTask&) = delete;
+    CoroTask& operator=(const CoroTask&) = delete;
+
+private:
+    friend class CoroExecutor;
+
+    explicit CoroTask(std::coroutine_handle<promise_type> handle);
+
+    std::coroutine_handle<promise_type> handle;
+};
+
+/*
+ * Minimal single-threaded executor: a FIFO of coroutines ready to run,
+ * drained by run() on the calling thread. Coroutines that suspend on
+ * something else (an AsyncQueue, say) are resumed by whoever completes it,
+ * not by the executor; the executor only owns their frames.
+ *
+ * Not thread-safe: spawn, yield and run must all happen on one thread.
+ */
+class CoroExecutor {
+public:
+    // Awaitable that puts the current coroutine at the back of the ready queue
+    class YieldAwaiter {
+    public:
+        bool await_ready() const noexcept {
+            return false;
+        }
+        void await_suspend(std::coroutine_handle<> handle) const;
+        void await_resume() const noexcept {
+        }
+
+    private:
+        friend class CoroExecutor;
+
+        explicit YieldAwaiter(CoroExecutor& executor);
+
+        CoroExecutor* executor;
+    };
+
+    CoroExecutor() = default;
+    ~CoroExecutor(); // destroys every spawned task, finished or not
+
+    CoroExecutor(const CoroExecutor&) = delete;
+    CoroExecutor& operator=(const CoroExecutor&) = delete;
+
+    // 🚀 APIs
+    void spawn(CoroTask task); // runs on the next run()
+    YieldAwaiter yield(); // co_await executor.yield()
+    /*
+     * Resumes ready coroutines in FIFO order until none is left, then frees
+     * finished tasks. Rethrows the first exception a finished task ended
+     * with. Returns the number of resumptions.
+     */
+    int run();
+
+    // 👀 Accessors
+    int getTaskCount() const; // spawned tasks that have not finished
+    int getReadyCount() const;
+
+private:
+    void reap();
+
+    std::deque<std::coroutine_handle<>> ready;
+    std::vector<std::coroutine_handle<CoroTask::promise_type>> tasks;
+};
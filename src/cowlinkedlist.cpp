@@ -0,0 +1,198 @@
+#include "cowlinkedlist.hpp"
+
+#include <ostream>
+#include <utility>
+
+namespace {
+
+// Deep copy that, unlike LinkedList's copy constructor, stays on the source's
+// resource: a handle built on a pool keeps allocating from that pool
+LinkedList privateCopy(const LinkedList& source) {
+    if (source.getResource() == nullptr)
+        return LinkedList(source);
+
+    LinkedList copy(source.getResource());
+    for (const Node* node = source.getHead(); node != nullptr; node = node->getNext()) {
+        copy.append(node->getData());
+    }
+    return copy;
+}
+
+} // namespace
+
+CowLinkedList::CowLinkedList(const int value, std::pmr::memory_resource* resource)
+    : shared{new Shared(value, resource)} {
+}
+
+CowLinkedList::CowLinkedList(LinkedList&& list)
+    : shared{new Shared(std::move(list))} {
+}
+
+CowLinkedList::CowLinkedList(const CowLinkedList& other)
+    : shared{other.shared} {
+    // copied from a reference we hold: the list cannot go away meanwhile
+    shared->handles.fetch_add(1, std::memory_order_relaxed);
+}
+
+CowLinkedList& CowLinkedList::operator=(const CowLinkedList& other) {
+    if (this != &other) {
+        other.shared->handles.fetch_add(1, std::memory_order_relaxed);
+        release(shared);
+        shared = other.shared;
+    }
+    return *this;
+}
+
+CowLinkedList::~CowLinkedList() {
+    release(shared);
+}
+
+void CowLinkedList::release(Shared* shared) {
+    // acq_rel: the last handle frees the list only after every other
+    // handle's accesses to it, and those happen before its own decrement
+    if (shared->handles.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        delete shared;
+}
+
+LinkedList& CowLinkedList::detach() {
+    /*
+     * A count of 1 means no other handle can reach the list, so mutating it
+     * in place is safe even with other threads around. The load is acquire
+     * so that, having seen the last other handle go, our writes come after
+     * everything that handle read (shared_ptr::use_count() is a relaxed load
+     * and gives no such ordering). A count that drops to 1 concurrently just
+     * costs one unnecessary copy.
+     */
+    if (shared->handles.load(std::memory_order_acquire) > 1) {
+        Shared* copy = new Shared(privateCopy(shared->list));
+        release(shared);
+        shared = copy;
+    }
+    return shared->list;
+}
+
+// Mutating APIs
+
+void CowLinkedList::append(const int value) {
+    detach().append(value);
+}
+
+void CowLinkedList::prepend(const int value) {
+    detach().prepend(value);
+}
+
+void CowLinkedList::deleteLast() {
+    if (shared->list.getLength() > 0)
+        detach().deleteLast();
+}
+
+void CowLinkedList::deleteFirst() {
+    if (shared->list.getLength() > 0)
+        detach().deleteFirst();
+}
+
+void CowLinkedList::deleteNode(const int index) {
+    // an out-of-range call would be a no-op: don't copy for it
+    if (index >= 0 && index < shared->list.getLength())
+        detach().deleteNode(index);
+}
+
+bool CowLinkedList::set(const int index, const int value) {
+    if (index < 0 || index >= shared->list.getLength())
+        return false;
+    return detach().set(index, value);
+}
+
+bool CowLinkedList::insert(const int index, const int value) {
+    if (index < 0 || index > shared->list.getLength())
+        return false;
+    return detach().insert(index, value);
+}
+
+void CowLinkedList::reverse() {
+    if (shared->list.getLength() > 1)
+        detach().reverse();
+}
+
+void CowLinkedList::removeDuplicates() {
+    detach().removeDuplicates();
+}
+
+void CowLinkedList::partitionList(const int limit) {
+    detach().partitionList(limit);
+}
+
+void CowLinkedList::reverseBetween(const int m, const int n) {
+    detach().reverseBetween(m, n);
+}
+
+void CowLinkedList::swapPairs() {
+    if (shared->list.getLength() > 1)
+        detach().swapPairs();
+}
+
+void CowLinkedList::clear() {
+    if (shared->handles.load(std::memory_order_acquire) > 1) {
+        Shared* empty = new Shared(shared->list.getResource());
+        release(shared);
+        shared = empty;
+    } else {
+        shared->list.clear();
+    }
+}
+
+// Read-only APIs
+
+const Node* CowLinkedList::get(const int index) const {
+    return shared->list.get(index);
+}
+
+const Node* CowLinkedList::findMiddleNode() const {
+    return shared->list.findMiddleNode();
+}
+
+const Node* CowLinkedList::findKthFromEnd(const int k) const {
+    return shared->list.findKthFromEnd(k);
+}
+
+bool CowLinkedList::hasLoop() const {
+    return shared->list.hasLoop();
+}
+
+int CowLinkedList::binaryToDecimal() const {
+    return shared->list.binaryToDecimal();
+}
+
+LinkedList& CowLinkedList::mutableList() {
+    return detach();
+}
+
+// Accessors
+
+const Node* CowLinkedList::getHead() const {
+    return shared->list.getHead();
+}
+
+const Node* CowLinkedList::getTail() const {
+    return shared->list.getTail();
+}
+
+int CowLinkedList::getLength() const {
+    return shared->list.getLength();
+}
+
+std::pmr::memory_resource* CowLinkedList::getResource() const {
+    return shared->list.getResource();
+}
+
+bool CowLinkedList::isShared() const {
+    return shared->handles.load(std::memory_order_relaxed) > 1;
+}
+
+long CowLinkedList::getShareCount() const {
+    return shared->handles.load(std::memory_order_relaxed);
+}
+
+std::ostream& operator<<(std::ostream& stream, const CowLinkedList& list) {
+    return stream << list.shared->list;
+}
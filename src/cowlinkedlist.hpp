@@ -0,0 +1,101 @@
+#pragma once
+
+#include <atomic>
+#include <iosfwd>
+#include <memory_resource>
+#include <utility>
+
+#include "linkedlist.hpp"
+
+/*
+ * Copy-on-write handle over a LinkedList.
+ *
+ * Copies share one underlying list, so copying (and keeping a read-only copy
+ * around) is O(1) in time and memory: one reference-count increment. The
+ * first mutating call on a handle whose list is shared materializes a private
+ * deep copy first; from then on that handle mutates in place again.
+ *
+ * Unlike LinkedList, nothing here hands out a mutable Node*: reads return
+ * const nodes or values, so a reader cannot write through a node another copy
+ * still sees. mutableList() is the escape hatch for the full LinkedList API.
+ *
+ * Sharing is thread-safe in the same sense as std::shared_ptr: distinct
+ * handles over the same list may be read, copied, mutated and destroyed from
+ * different threads; a single handle must not be used concurrently. The one
+ * exception is a build with ENABLE_CONTAINER_STATS, where reads such as get()
+ * bump the shared list's (non-atomic) counters: there, handles sharing a list
+ * must not be read from several threads at once.
+ */
+class CowLinkedList {
+public:
+    explicit CowLinkedList(int value, std::pmr::memory_resource* resource = nullptr);
+    explicit CowLinkedList(LinkedList&& list); // adopts the nodes, O(1)
+
+    // O(1): shares the list. There are no separate move operations, so a
+    // "moved-from" handle still shares the list and stays usable.
+    CowLinkedList(const CowLinkedList& other);
+    CowLinkedList& operator=(const CowLinkedList& other);
+    ~CowLinkedList();
+
+    // 🚀 Mutating APIs (copy first if the list is shared)
+    void append(int value);
+    void prepend(int value);
+    void deleteLast();
+    void deleteFirst();
+    void deleteNode(int index);
+    bool set(int index, int value);
+    bool insert(int index, int value);
+    void reverse();
+    void removeDuplicates();
+    void partitionList(int limit);
+    void reverseBetween(int m, int n);
+    void swapPairs();
+    void clear(); // never copies: a shared list is simply let go
+
+    // 🔍 Read-only APIs (never copy)
+    const Node* get(int index) const;
+    const Node* findMiddleNode() const;
+    const Node* findKthFromEnd(int k) const;
+    bool hasLoop() const;
+    int binaryToDecimal() const;
+
+    /*
+     * Detaches if needed and returns the private list, for APIs not mirrored
+     * here. Do not keep the reference across a copy of this handle: the copy
+     * shares the very same list, so later writes through the reference would
+     * show up in the copy too. Call mutableList() again after copying.
+     */
+    LinkedList& mutableList();
+
+    // 👀 Accessors
+    const Node* getHead() const;
+    const Node* getTail() const;
+    int getLength() const;
+    std::pmr::memory_resource* getResource() const; // nullptr: global heap
+    bool isShared() const;
+    long getShareCount() const; // handles currently sharing this list
+
+    friend std::ostream& operator<<(std::ostream& stream, const CowLinkedList& list);
+
+private:
+    // One list and the number of handles sharing it
+    struct Shared {
+        template <typename... Args>
+        explicit Shared(Args&&... args)
+            : list(std::forward<Args>(args)...) {
+        }
+
+        LinkedList list;
+        std::atomic<long> handles{1};
+    };
+
+    // Drops this handle's reference, freeing the list if it was the last one
+    static void release(Shared* shared);
+
+    // Makes the list private to this handle, deep-copying it if it is shared
+    LinkedList& detach();
+
+    Shared* shared;
+};
+
+std::ostream& operator<<(std::ostream& stream, const CowLinkedList& list);
@@ -0,0 +1,352 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/*
+ * d-ary heap priority queue.
+ *
+ * A binary heap touches a new cache line at almost every level of a sift. With
+ * Arity = 4 the tree is half as deep and the four children of a node sit next
+ * to each other, so a sift-down compares them within one or two cache lines.
+ * Push is O(log_d n), pop is O(d log_d n), and building from a range is O(n).
+ *
+ * With the default Compare (std::less) the smallest element is on top, i.e.
+ * lower value = higher priority, like job deadlines.
+ */
+template <typename T, std::size_t Arity = 4, typename Compare = std::less<T>>
+class DaryHeap {
+    static_assert(Arity >= 2, "a heap node needs at least two children");
+
+public:
+    DaryHeap() = default;
+
+    explicit DaryHeap(Compare compare)
+        : before{std::move(compare)} {
+    }
+
+    // Builds the heap from [first, last) in O(n)
+    template <typename InputIt>
+    DaryHeap(InputIt first, InputIt last, Compare compare = Compare{})
+        : before{std::move(compare)} {
+        assign(first, last);
+    }
+
+    // 🚀 DaryHeap APIs
+    void push(T value) {
+        items.push_back(std::move(value));
+        siftUp(items.size() - 1);
+    }
+
+    // Removes and returns the top element, or std::nullopt when empty
+    std::optional<T> pop() {
+        if (items.empty())
+            return std::nullopt;
+
+        T top = std::move(items.front());
+        if (items.size() > 1) {
+            items.front() = std::move(items.back());
+        }
+        items.pop_back();
+        if (!items.empty()) {
+            siftDown(0);
+        }
+        return top;
+    }
+
+    // The top element, or nullptr when empty
+    const T* peek() const {
+        return items.empty() ? nullptr : &items.front();
+    }
+
+    /*
+     * Replaces the contents with [first, last) using Floyd's bottom-up
+     * heapify: sift down every internal node, last parent first. Most nodes
+     * are near the leaves and barely move, so the total work is O(n).
+     */
+    template <typename InputIt>
+    void assign(InputIt first, InputIt last) {
+        items.assign(first, last);
+        if (items.size() < 2)
+            return;
+        for (std::size_t i = parent(items.size() - 1) + 1; i-- > 0;) {
+            siftDown(i);
+        }
+    }
+
+    void reserve(const std::size_t capacity) {
+        items.reserve(capacity);
+    }
+
+    void clear() {
+        items.clear();
+    }
+
+    // 👀 Accessors
+    std::size_t getSize() const {
+        return items.size();
+    }
+
+    bool empty() const {
+        return items.empty();
+    }
+
+    // The underlying array in heap order (for tests and debugging)
+    const std::vector<T>& data() const {
+        return items;
+    }
+
+private:
+    static std::size_t parent(const std::size_t i) {
+        return (i - 1) / Arity;
+    }
+
+    static std::size_t firstChild(const std::size_t i) {
+        return i * Arity + 1;
+    }
+
+    // Moves a hole up instead of swapping, so each level costs one move
+    void siftUp(std::size_t i) {
+        T value = std::move(items[i]);
+        while (i > 0) {
+            const std::size_t p = parent(i);
+            if (!before(value, items[p]))
+                break;
+            items[i] = std::move(items[p]);
+            i = p;
+        }
+        items[i] = std::move(value);
+    }
+
+    void siftDown(std::size_t i) {
+        const std::size_t n = items.size();
+        T value = std::move(items[i]);
+        while (true) {
+            const std::size_t first = firstChild(i);
+            if (first >= n)
+                break;
+            const std::size_t last = first + Arity < n ? first + Arity : n;
+
+            std::size_t best = first;
+            for (std::size_t c = first + 1; c < last; ++c) {
+                if (before(items[c], items[best]))
+                    best = c;
+            }
+            if (!before(items[best], value))
+                break;
+            items[i] = std::move(items[best]);
+            i = best;
+        }
+        items[i] = std::move(value);
+    }
+
+    std::vector<T> items;
+    [[no_unique_address]] Compare before;
+};
+
+/*
+ * d-ary heap whose elements can be found again after they move.
+ *
+ * push() returns a Handle that stays valid until the element is popped or
+ * erased. Through it, decreaseKey()/update() re-prioritise an element and
+ * erase() removes it, each in O(log_d n), without searching the heap. This is
+ * what Dijkstra, timers and schedulers with changing deadlines need.
+ *
+ * Internally the heap stores handles; a slot table maps each handle to its
+ * value and current heap position. Freed handles are recycled.
+ */
+template <typename T, std::size_t Arity = 4, typename Compare = std::less<T>>
+class AddressableDaryHeap {
+    static_assert(Arity >= 2, "a heap node needs at least two children");
+
+public:
+    using Handle = std::uint32_t;
+    static constexpr Handle kInvalidHandle = UINT32_MAX;
+
+    AddressableDaryHeap() = default;
+
+    explicit AddressableDaryHeap(Compare compare)
+        : before{std::move(compare)} {
+    }
+
+    // 🚀 AddressableDaryHeap APIs
+    Handle push(T value) {
+        Handle handle;
+        if (freeHead != kInvalidHandle) {
+            handle = freeHead;
+            freeHead = slots[handle].position;
+            slots[handle].value = std::move(value);
+        } else {
+            handle = static_cast<Handle>(slots.size());
+            slots.push_back(Slot{std::move(value), 0});
+        }
+        slots[handle].position = static_cast<std::uint32_t>(heap.size());
+        heap.push_back(handle);
+        siftUp(heap.size() - 1);
+        return handle;
+    }
+
+    std::optional<T> pop() {
+        if (heap.empty())
+            return std::nullopt;
+        const Handle top = heap.front();
+        T value = std::move(slots[top].value);
+        removeAt(0);
+        release(top);
+        return value;
+    }
+
+    const T* peek() const {
+        return heap.empty() ? nullptr : &slots[heap.front()].value;
+    }
+
+    Handle topHandle() const {
+        return heap.empty() ? kInvalidHandle : heap.front();
+    }
+
+    /*
+     * Gives an element a higher priority (a value that compares before the
+     * current one). Returns false, changing nothing, if the handle is not live
+     * or the new value would lower the priority.
+     */
+    bool decreaseKey(const Handle handle, T value) {
+        if (!contains(handle) || before(slots[handle].value, value))
+            return false;
+        slots[handle].value = std::move(value);
+        siftUp(slots[handle].position);
+        return true;
+    }
+
+    // Sets any new value, moving the element up or down as needed
+    bool update(const Handle handle, T value) {
+        if (!contains(handle))
+            return false;
+        const bool raised = before(value, slots[handle].value);
+        slots[handle].value = std::move(value);
+        if (raised) {
+            siftUp(slots[handle].position);
+        } else {
+            siftDown(slots[handle].position);
+        }
+        return true;
+    }
+
+    bool erase(const Handle handle) {
+        if (!contains(handle))
+            return false;
+        removeAt(slots[handle].position);
+        release(handle);
+        return true;
+    }
+
+    // The element behind a live handle, or nullptr
+    const T* get(const Handle handle) const {
+        return contains(handle) ? &slots[handle].value : nullptr;
+    }
+
+    bool contains(const Handle handle) const {
+        return handle < slots.size() && slots[handle].position < heap.size() &&
+            heap[slots[handle].position] == handle;
+    }
+
+    void clear() {
+        heap.clear();
+        slots.clear();
+        freeHead = kInvalidHandle;
+    }
+
+    // 👀 Accessors
+    std::size_t getSize() const {
+        return heap.size();
+    }
+
+    bool empty() const {
+        return heap.empty();
+    }
+
+private:
+    struct Slot {
+        T value;
+        std::uint32_t position; // index in `heap`; next free handle once released
+    };
+
+    static std::size_t parent(const std::size_t i) {
+        return (i - 1) / Arity;
+    }
+
+    static std::size_t firstChild(const std::size_t i) {
+        return i * Arity + 1;
+    }
+
+    void place(const std::size_t i, const Handle handle) {
+        heap[i] = handle;
+        slots[handle].position = static_cast<std::uint32_t>(i);
+    }
+
+    void siftUp(std::size_t i) {
+        const Handle handle = heap[i];
+        while (i > 0) {
+            const std::size_t p = parent(i);
+            if (!before(slots[handle].value, slots[heap[p]].value))
+                break;
+            place(i, heap[p]);
+            i = p;
+        }
+        place(i, handle);
+    }
+
+    void siftDown(std::size_t i) {
+        const std::size_t n = heap.size();
+        const Handle handle = heap[i];
+        while (true) {
+            const std::size_t first = firstChild(i);
+            if (first >= n)
+                break;
+            const std::size_t last = first + Arity < n ? first + Arity : n;
+
+            std::size_t best = first;
+            for (std::size_t c = first + 1; c < last; ++c) {
+                if (before(slots[heap[c]].value, slots[heap[best]].value))
+                    best = c;
+            }
+            if (!before(slots[heap[best]].value, slots[handle].value))
+                break;
+            place(i, heap[best]);
+            i = best;
+        }
+        place(i, handle);
+    }
+
+    // Fills position i with the last element and restores the heap order
+    void removeAt(const std::size_t i) {
+        const Handle last = heap.back();
+        heap.pop_back();
+        if (i == heap.size())
+            return;
+        place(i, last);
+        if (i > 0 && before(slots[last].value, slots[heap[parent(i)]].value)) {
+            siftUp(i);
+        } else {
+            siftDown(i);
+        }
+    }
+
+    // Puts a handle on the free list; its position now links to the next free one
+    void release(const Handle handle) {
+        if constexpr (std::is_default_constructible_v<T>) {
+            slots[handle].value = T{}; // drop whatever an erased value owned
+        }
+        slots[handle].position = freeHead;
+        freeHead = handle;
+    }
+
+    std::vector<Handle> heap;
+    std::vector<Slot> slots;
+    Handle freeHead = kInvalidHandle;
+    [[no_unique_address]] Compare before;
+};
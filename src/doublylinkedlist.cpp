@@ -1,6 +1,9 @@
 #include "doublylinkedlist.hpp"
 
 #include <iostream>
+#include <new>
+
+#include "prefetch.hpp"
 
 DNode::DNode(int value)
     : value{value},
@@ -13,11 +16,39 @@ int DNode::getData() const {
     return this->value;
 }
 
-DoublyLinkedList::DoublyLinkedList(int value) {
-    DNode* newNode = new DNode(value);
+// Node allocation: every node the list owns is created and destroyed here
+DNode* DoublyLinkedList::createNode(const int value) {
+    stats.recordAllocation(sizeof(DNode));
+    if (resource) {
+        return new (resource->allocate(sizeof(DNode), alignof(DNode))) DNode(value);
+    }
+    return new DNode(value);
+}
+
+void DoublyLinkedList::destroyNode(DNode* node) {
+    stats.recordDeallocation(sizeof(DNode));
+    if (resource) {
+        node->~DNode();
+        resource->deallocate(node, sizeof(DNode), alignof(DNode));
+        return;
+    }
+    delete node;
+}
+
+DoublyLinkedList::DoublyLinkedList(std::pmr::memory_resource* resource)
+    : head{nullptr},
+      tail{nullptr},
+      length{0},
+      resource{resource} {
+}
+
+DoublyLinkedList::DoublyLinkedList(const int value, std::pmr::memory_resource* resource)
+    : resource{resource} {
+    DNode* newNode = createNode(value);
     head = newNode;
     tail = newNode;
     length = 1;
+    stats.recordInsert(length);
 }
 
 DoublyLinkedList::~DoublyLinkedList() {
@@ -28,7 +59,7 @@ void DoublyLinkedList::clear() {
     DNode* current = head;
     while (current != nullptr) {
         DNode* next = current->next;
-        delete current;
+        destroyNode(current);
         current = next;
     }
     head = tail = nullptr;
@@ -63,7 +94,7 @@ void DoublyLinkedList::display() const {
 }
 
 void DoublyLinkedList::append(const int value) {
-    DNode* newNode = new DNode(value);
+    DNode* newNode = createNode(value);
     // empty list
     if (head == nullptr) {
         head = newNode;
@@ -74,10 +105,11 @@ void DoublyLinkedList::append(const int value) {
         tail = newNode;
     }
     ++length;
+    stats.recordInsert(length);
 }
 
 void DoublyLinkedList::prepend(const int value) {
-    DNode* newNode = new DNode(value);
+    DNode* newNode = createNode(value);
     if (head == nullptr) {
         head = newNode;
         tail = newNode;
@@ -87,11 +119,14 @@ void DoublyLinkedList::prepend(const int value) {
         head = newNode;
     }
     ++length;
+    stats.recordInsert(length);
 }
 
 void DoublyLinkedList::deleteLast() {
-    if (length == 0)
+    if (length == 0) {
+        stats.recordEmptyRemoval();
         return; // empty list
+    }
 
     DNode* temp = tail;
     if (length == 1) {
@@ -103,13 +138,16 @@ void DoublyLinkedList::deleteLast() {
         tail = tail->prev;
         tail->next = nullptr;
     }
-    delete temp;
+    destroyNode(temp);
     --length;
+    stats.recordRemoval();
 }
 
 void DoublyLinkedList::deleteFirst() {
-    if (length == 0)
+    if (length == 0) {
+        stats.recordEmptyRemoval();
         return; // empty list
+    }
     DNode* temp = head;
     if (length == 1) {
         // single node list
@@ -120,8 +158,9 @@ void DoublyLinkedList::deleteFirst() {
         head = head->next;
         head->prev = nullptr;
     }
-    delete temp;
+    destroyNode(temp);
     --length;
+    stats.recordRemoval();
 }
 
 DNode* DoublyLinkedList::get(const int index) const {
@@ -139,13 +178,16 @@ DNode* DoublyLinkedList::get(const int index) const {
     if (index < length / 2) {
         for (int i = 0; i < index; ++i) {
             target = target->next;
+            prefetchForRead(target->next); // the node after next
         }
     } else {
         target = tail;
         for (int i = length - 1; i > index; --i) {
             target = target->prev;
+            prefetchForRead(target->prev);
         }
     }
+    stats.recordLookup(index < length / 2 ? index : length - 1 - index);
     return target;
 }
 
@@ -174,17 +216,7 @@ bool DoublyLinkedList::insertNode(int index, int value) {
         return true;
     }
 
-    DNode* newNode = new DNode(value);
-    DNode* before = get(index - 1);
-    DNode* after = before->next;
-
-    newNode->prev = before;
-    newNode->next = after;
-    before->next = newNode;
-    after->prev = newNode;
-
-    ++length;
-
+    insertAfter(get(index - 1), value);
     return true;
 }
 
@@ -211,12 +243,108 @@ void DoublyLinkedList::deleteNode(int index) {
     // --length;
 
     // option 2: Unlink the target node by updating its neighbors
-    DNode* target = get(index);
-    if (!target)
+    eraseAt(get(index));
+}
+
+// Node-handle APIs
+// Callers that already hold a DNode* (e.g. from get() or a previous insert)
+// can edit around it without the O(n) index walk.
+
+void DoublyLinkedList::eraseAt(DNode* node) {
+    if (node == nullptr)
         return;
 
-    target->next->prev = target->prev;
-    target->prev->next = target->next;
-    delete target;
+    unlink(node);
+    destroyNode(node);
     --length;
+    stats.recordRemoval();
+}
+
+DNode* DoublyLinkedList::insertBefore(DNode* node, const int value) {
+    if (node == nullptr)
+        return nullptr;
+
+    DNode* newNode = createNode(value);
+    newNode->next = node;
+    newNode->prev = node->prev;
+
+    if (node->prev) {
+        node->prev->next = newNode;
+    } else {
+        head = newNode;
+    }
+    node->prev = newNode;
+
+    ++length;
+    stats.recordInsert(length);
+    return newNode;
+}
+
+DNode* DoublyLinkedList::insertAfter(DNode* node, const int value) {
+    if (node == nullptr)
+        return nullptr;
+
+    DNode* newNode = createNode(value);
+    newNode->prev = node;
+    newNode->next = node->next;
+
+    if (node->next) {
+        node->next->prev = newNode;
+    } else {
+        tail = newNode;
+    }
+    node->next = newNode;
+
+    ++length;
+    stats.recordInsert(length);
+    return newNode;
+}
+
+void DoublyLinkedList::moveToFront(DNode* node) {
+    if (node == nullptr || node == head)
+        return;
+
+    unlink(node);
+    node->next = head;
+    head->prev = node;
+    head = node;
+}
+
+void DoublyLinkedList::moveToBack(DNode* node) {
+    if (node == nullptr || node == tail)
+        return;
+
+    unlink(node);
+    node->prev = tail;
+    tail->next = node;
+    tail = node;
+}
+
+std::pmr::memory_resource* DoublyLinkedList::getResource() const {
+    return resource;
+}
+
+StatsSnapshot DoublyLinkedList::getStats() const {
+    return stats.snapshot();
+}
+
+void DoublyLinkedList::resetStats() {
+    stats.reset();
+}
+
+void DoublyLinkedList::unlink(DNode* node) {
+    // detach the node from its neighbours (or from head/tail), keep length
+    if (node->prev) {
+        node->prev->next = node->next;
+    } else {
+        head = node->next;
+    }
+
+    if (node->next) {
+        node->next->prev = node->prev;
+    } else {
+        tail = node->prev;
+    }
+
+    node->next = node->prev = nullptr;
 }
\ No newline at end of file
@@ -1,5 +1,9 @@
 #pragma once
 
+#include <memory_resource>
+
+#include "containerstats.hpp"
+
 class DNode {
 public:
     int value;
@@ -14,7 +18,13 @@ public:
 
 class DoublyLinkedList {
 public:
-    explicit DoublyLinkedList(int value);
+    /*
+     * Nodes are allocated from `resource` (a pool, monotonic or NUMA-local
+     * std::pmr::memory_resource) when one is given, and with plain new/delete
+     * otherwise. The resource must outlive the list.
+     */
+    explicit DoublyLinkedList(std::pmr::memory_resource* resource = nullptr); // empty list
+    explicit DoublyLinkedList(int value, std::pmr::memory_resource* resource = nullptr);
     ~DoublyLinkedList();
     void clear();
     void display() const;
@@ -27,14 +37,33 @@ public:
     bool insertNode(int index, int value);
     void deleteNode(int index);
 
+    // O(1) node-handle APIs: `node` must belong to this list
+    void eraseAt(DNode* node);
+    DNode* insertBefore(DNode* node, int value);
+    DNode* insertAfter(DNode* node, int value);
+    void moveToFront(DNode* node);
+    void moveToBack(DNode* node);
 
     // accessors
     int getLength() const;
     DNode* getHead() const;
     DNode* getTail() const;
 
+    // nullptr when nodes come from the global heap
+    std::pmr::memory_resource* getResource() const;
+
+    // 📊 Usage counters (all zero unless built with ENABLE_CONTAINER_STATS)
+    StatsSnapshot getStats() const;
+    void resetStats();
+
 private:
+    DNode* createNode(int value);
+    void destroyNode(DNode* node);
+    void unlink(DNode* node);
+
     DNode* head;
     DNode* tail;
     int length;
+    std::pmr::memory_resource* resource;
+    [[no_unique_address]] mutable ContainerStats stats;
 };
\ No newline at end of file
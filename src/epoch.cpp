@@ -0,0 +1,247 @@
+#include "epoch.hpp"
+
+#include <algorithm>
+#include <mutex>
+
+#if defined(__linux__)
+#include <linux/membarrier.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#if defined(__SANITIZE_THREAD__)
+#define DS_EPOCH_TSAN 1
+#elif defined(__has_feature)
+#if __has_feature(thread_sanitizer)
+#define DS_EPOCH_TSAN 1
+#endif
+#endif
+
+namespace {
+
+// Registers the process for expedited membarrier(); false if unsupported
+bool asymmetricBarrierAvailable() {
+#if defined(__linux__) && defined(__NR_membarrier) && !defined(DS_EPOCH_TSAN)
+    static const bool available =
+        syscall(__NR_membarrier, MEMBARRIER_CMD_REGISTER_PRIVATE_EXPEDITED, 0, 0) == 0;
+    return available;
+#else
+    return false;
+#endif
+}
+
+// A full barrier executed on every CPU running one of our threads
+void heavyBarrier() {
+#if defined(__linux__) && defined(__NR_membarrier)
+    syscall(__NR_membarrier, MEMBARRIER_CMD_PRIVATE_EXPEDITED, 0, 0);
+#endif
+}
+
+std::atomic<std::uint64_t> nextDomainId{1};
+
+// Ids of the domains still alive. A thread that exits holds the mutex while
+// handing its slots back, so a domain cannot free them underneath it.
+std::mutex liveDomainsMutex;
+std::vector<std::uint64_t> liveDomains;
+
+} // namespace
+
+// The slots the current thread owns, one per domain it has used
+struct EpochThreadSlots {
+    struct Entry {
+        std::uint64_t domainId;
+        EpochDomain::Slot* slot;
+    };
+
+    std::vector<Entry> entries;
+
+    ~EpochThreadSlots() {
+        const std::lock_guard<std::mutex> lock(liveDomainsMutex);
+        for (const Entry& entry : entries) {
+            if (std::find(liveDomains.begin(), liveDomains.end(), entry.domainId) ==
+                liveDomains.end())
+                continue; // the domain is gone, and its slots with it
+            // pending objects stay in the slot for its next owner to free
+            entry.slot->state.store(0, std::memory_order_release);
+            entry.slot->owned.store(false, std::memory_order_release);
+        }
+    }
+};
+
+namespace {
+thread_local EpochThreadSlots threadSlots;
+} // namespace
+
+// Guard
+
+EpochDomain::Guard::Guard(EpochDomain& domain)
+    : slot{domain.pin()} {
+}
+
+EpochDomain::Guard::~Guard() {
+    unpin(slot);
+}
+
+// Domain
+
+EpochDomain::EpochDomain(const PinMode mode)
+    : id{nextDomainId.fetch_add(1, std::memory_order_relaxed)},
+      pinMode{mode == PinMode::Asymmetric && asymmetricBarrierAvailable() ? PinMode::Asymmetric
+                                                                          : PinMode::Fenced},
+      epoch{0},
+      slots{nullptr} {
+    const std::lock_guard<std::mutex> lock(liveDomainsMutex);
+    liveDomains.push_back(id);
+}
+
+EpochDomain::~EpochDomain() {
+    {
+        const std::lock_guard<std::mutex> lock(liveDomainsMutex);
+        liveDomains.erase(std::find(liveDomains.begin(), liveDomains.end(), id));
+    }
+    Slot* slot = slots.load(std::memory_order_acquire);
+    while (slot != nullptr) {
+        for (const Retired& retired : slot->retired) {
+            retired.deleter(retired.pointer);
+        }
+        Slot* next = slot->next;
+        delete slot;
+        slot = next;
+    }
+}
+
+EpochDomain::Slot& EpochDomain::localSlot() {
+    for (const EpochThreadSlots::Entry& entry : threadSlots.entries) {
+        if (entry.domainId == id)
+            return *entry.slot;
+    }
+    {
+        // first use of this domain on this thread: drop entries of dead ones
+        const std::lock_guard<std::mutex> lock(liveDomainsMutex);
+        std::erase_if(threadSlots.entries, [](const EpochThreadSlots::Entry& entry) {
+            return std::find(liveDomains.begin(), liveDomains.end(), entry.domainId) ==
+                liveDomains.end();
+        });
+    }
+    Slot& slot = acquireSlot();
+    threadSlots.entries.push_back({id, &slot});
+    return slot;
+}
+
+EpochDomain::Slot& EpochDomain::acquireSlot() {
+    // reuse the slot of a thread that has exited...
+    for (Slot* slot = slots.load(std::memory_order_acquire); slot; slot = slot->next) {
+        bool expected = false;
+        if (slot->owned.compare_exchange_strong(expected, true, std::memory_order_acq_rel))
+            return *slot;
+    }
+    // ...or publish a new one
+    auto* slot = new Slot;
+    slot->next = slots.load(std::memory_order_relaxed);
+    while (!slots.compare_exchange_weak(slot->next, slot, std::memory_order_release,
+                                        std::memory_order_relaxed)) {
+    }
+    return *slot;
+}
+
+EpochDomain::Slot& EpochDomain::pin() {
+    Slot& slot = localSlot();
+    if (slot.nesting++ == 0) {
+        const std::uint64_t current = epoch.load(std::memory_order_relaxed);
+        if (pinMode == PinMode::Asymmetric) {
+            // the advancer's membarrier() orders this store for us
+            slot.state.store(current << 1 | 1, std::memory_order_relaxed);
+            std::atomic_signal_fence(std::memory_order_seq_cst);
+        } else {
+            /*
+             * The announcement must be visible before we read any shared
+             * pointer. An exchange (rather than a store) also extends the
+             * release sequence of our last unpin, so an advancer that reads
+             * the new state still synchronizes with everything we did while
+             * pinned before. On x86 the locked exchange is already a full
+             * barrier.
+             */
+            slot.state.exchange(current << 1 | 1, std::memory_order_seq_cst);
+#if !(defined(__x86_64__) || defined(__i386__))
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+#endif
+        }
+    }
+    return slot;
+}
+
+void EpochDomain::unpin(Slot& slot) {
+    if (--slot.nesting == 0) {
+        slot.state.store(0, std::memory_order_release);
+    }
+}
+
+bool EpochDomain::tryAdvance() {
+    /*
+     * The epoch may move from e to e + 1 only when every pinned thread has
+     * announced e: then nobody is still running an operation that began in
+     * e - 1, and objects retired in e - 1 are unreachable to everyone.
+     */
+    std::uint64_t current = epoch.load(std::memory_order_relaxed);
+    if (pinMode == PinMode::Asymmetric) {
+        heavyBarrier(); // makes every reader's pin store visible, in order
+    }
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    for (Slot* slot = slots.load(std::memory_order_acquire); slot; slot = slot->next) {
+        const std::uint64_t state = slot->state.load(std::memory_order_acquire);
+        if ((state & 1) != 0 && (state >> 1) != current)
+            return false;
+    }
+    return epoch.compare_exchange_strong(current, current + 1, std::memory_order_acq_rel,
+                                         std::memory_order_relaxed);
+}
+
+std::size_t EpochDomain::freeSafe(Slot& slot) {
+    const std::uint64_t current = epoch.load(std::memory_order_acquire);
+    // move the safe entries out first: a deleter may retire more objects
+    const auto firstUnsafe = std::stable_partition(
+        slot.retired.begin(), slot.retired.end(),
+        [current](const Retired& retired) { return retired.epoch + 2 <= current; });
+    std::vector<Retired> safe(slot.retired.begin(), firstUnsafe);
+    slot.retired.erase(slot.retired.begin(), firstUnsafe);
+    slot.pendingCount.store(slot.retired.size(), std::memory_order_relaxed);
+
+    for (const Retired& retired : safe) {
+        retired.deleter(retired.pointer);
+    }
+    return safe.size();
+}
+
+void EpochDomain::retire(void* pointer, void (*deleter)(void*)) {
+    Slot& slot = localSlot();
+    slot.retired.push_back({pointer, deleter, epoch.load(std::memory_order_acquire)});
+    slot.pendingCount.store(slot.retired.size(), std::memory_order_relaxed);
+    if (++slot.retiresSinceCollect >= kCollectInterval) {
+        collect();
+    }
+}
+
+std::size_t EpochDomain::collect() {
+    Slot& slot = localSlot();
+    slot.retiresSinceCollect = 0;
+    tryAdvance();
+    return freeSafe(slot);
+}
+
+// Accessors
+
+std::uint64_t EpochDomain::getEpoch() const {
+    return epoch.load(std::memory_order_relaxed);
+}
+
+EpochDomain::PinMode EpochDomain::getPinMode() const {
+    return pinMode;
+}
+
+std::size_t EpochDomain::getPendingCount() const {
+    std::size_t pending = 0;
+    for (Slot* slot = slots.load(std::memory_order_acquire); slot; slot = slot->next) {
+        pending += slot->pendingCount.load(std::memory_order_relaxed);
+    }
+    return pending;
+}
@@ -0,0 +1,114 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/*
+ * Epoch-based memory reclamation (Fraser's EBR) for lock-free containers.
+ *
+ * A lock-free reader may still be looking at a node that a writer has just
+ * unlinked, so the writer cannot free it right away. Instead:
+ *
+ *   - every operation on a shared structure runs inside a Guard, which pins
+ *     the calling thread to the current global epoch;
+ *   - an unlinked node is handed to retire() and tagged with that epoch;
+ *   - the global epoch only advances once every pinned thread has observed
+ *     it, so when it is two ahead of a node's tag no thread can still hold a
+ *     reference to the node, and the node is freed.
+ *
+ * Pinning is a store to a per-thread slot (no shared write, no lock), and
+ * retired nodes sit in the retiring thread's own list, so the read path never
+ * contends. By default the store is a fenced exchange. PinMode::Asymmetric
+ * moves that fence to the writers: a pin becomes a plain store, and every
+ * epoch advance issues a process-wide membarrier() instead, which suits
+ * read-mostly structures. Threads register with a domain automatically on first use; a
+ * thread that exits gives its slot (and its not-yet-freed nodes) back for
+ * reuse. A domain must outlive every structure using it, and no thread may be
+ * pinned when it is destroyed; the destructor frees whatever is still pending.
+ */
+class EpochDomain {
+    struct Slot;
+
+public:
+    enum class PinMode {
+        Fenced, // pin = one uncontended atomic exchange
+        Asymmetric, // pin = plain store; advancing the epoch pays a membarrier()
+    };
+
+    // Pins the calling thread for its lifetime. Guards nest.
+    class Guard {
+    public:
+        explicit Guard(EpochDomain& domain);
+        ~Guard();
+
+        Guard(const Guard&) = delete;
+        Guard& operator=(const Guard&) = delete;
+
+    private:
+        Slot& slot;
+    };
+
+    // Asymmetric falls back to Fenced where membarrier() is unavailable (and
+    // under ThreadSanitizer, which cannot see its ordering)
+    explicit EpochDomain(PinMode mode = PinMode::Fenced);
+    ~EpochDomain();
+
+    EpochDomain(const EpochDomain&) = delete;
+    EpochDomain& operator=(const EpochDomain&) = delete;
+
+    // Frees `pointer` with `deleter` once no pinned thread can reach it.
+    // Call only after the object was made unreachable for new readers.
+    void retire(void* pointer, void (*deleter)(void*));
+
+    template <typename T>
+    void retire(T* pointer) {
+        retire(static_cast<void*>(pointer), [](void* p) { delete static_cast<T*>(p); });
+    }
+
+    // Tries to advance the epoch and frees the calling thread's retired
+    // objects that became safe. Returns how many were freed. retire() does
+    // this on its own every kCollectInterval calls.
+    std::size_t collect();
+
+    // 👀 Accessors
+    std::uint64_t getEpoch() const;
+    PinMode getPinMode() const; // the mode actually in effect
+    std::size_t getPendingCount() const; // retired, not yet freed (all threads)
+
+    static constexpr std::size_t kCollectInterval = 64;
+
+private:
+    struct Retired {
+        void* pointer;
+        void (*deleter)(void*);
+        std::uint64_t epoch;
+    };
+
+    // One per registered thread; never freed before the domain
+    struct Slot {
+        // (epoch << 1) | 1 while pinned, 0 while quiescent
+        std::atomic<std::uint64_t> state{0};
+        std::atomic<bool> owned{true};
+        int nesting = 0; // touched by the owning thread only
+        std::size_t retiresSinceCollect = 0; // likewise
+        std::vector<Retired> retired; // likewise
+        std::atomic<std::size_t> pendingCount{0};
+        Slot* next = nullptr;
+    };
+
+    friend struct EpochThreadSlots;
+
+    Slot& localSlot();
+    Slot& acquireSlot();
+    Slot& pin();
+    static void unpin(Slot& slot);
+    bool tryAdvance();
+    std::size_t freeSafe(Slot& slot);
+
+    const std::uint64_t id; // never reused, unlike the domain's address
+    const PinMode pinMode;
+    std::atomic<std::uint64_t> epoch;
+    std::atomic<Slot*> slots; // lock-free stack of every slot ever created
+};
@@ -0,0 +1,474 @@
+#include "indexedlinkedlist.hpp"
+
+#include <climits>
+#include <utility>
+
+#include "simdscan.hpp"
+
+IndexedLinkedList::IndexedLinkedList(const int value)
+    : head{kNullSlot},
+      tail{kNullSlot},
+      freeList{kNullSlot},
+      length{0},
+      compacted{true} {
+    append(value);
+}
+
+IndexedLinkedList::IndexedLinkedList(IndexedLinkedList&& other) noexcept
+    : values(std::move(other.values)),
+      nextSlot(std::move(other.nextSlot)),
+      head{other.head},
+      tail{other.tail},
+      freeList{other.freeList},
+      length{other.length},
+      compacted{other.compacted} {
+    other.clear();
+}
+
+IndexedLinkedList& IndexedLinkedList::operator=(
+    IndexedLinkedList&& other) noexcept {
+    if (this != &other) {
+        values = std::move(other.values);
+        nextSlot = std::move(other.nextSlot);
+        head = other.head;
+        tail = other.tail;
+        freeList = other.freeList;
+        length = other.length;
+        compacted = other.compacted;
+        other.clear();
+    }
+    return *this;
+}
+
+void IndexedLinkedList::clear() {
+    // one O(1) release of the whole storage instead of a delete per node
+    values.clear();
+    nextSlot.clear();
+    head = tail = freeList = kNullSlot;
+    length = 0;
+    compacted = true;
+}
+
+// Slot management
+
+std::uint32_t IndexedLinkedList::allocateSlot(const int value) {
+    if (freeList != kNullSlot) {
+        const std::uint32_t slot = freeList;
+        freeList = nextSlot[slot];
+        values[slot] = value;
+        nextSlot[slot] = kNullSlot;
+        return slot;
+    }
+    values.push_back(value);
+    nextSlot.push_back(kNullSlot);
+    return static_cast<std::uint32_t>(values.size() - 1);
+}
+
+void IndexedLinkedList::releaseSlot(const std::uint32_t slot) {
+    nextSlot[slot] = freeList;
+    freeList = slot;
+}
+
+std::uint32_t IndexedLinkedList::slotAt(const int index) const {
+    // compacted storage is in list order, so no walk is needed
+    if (compacted)
+        return static_cast<std::uint32_t>(index);
+
+    std::uint32_t slot = head;
+    for (int i = 0; i < index; ++i) {
+        slot = nextSlot[slot];
+    }
+    return slot;
+}
+
+// IndexedLinkedList APIs
+
+void IndexedLinkedList::append(const int value) {
+    // while compacted the free list is empty, so the new slot is `length`
+    // and the storage stays in list order
+    const std::uint32_t slot = allocateSlot(value);
+    if (length == 0) {
+        head = tail = slot;
+    } else {
+        nextSlot[tail] = slot;
+        tail = slot;
+    }
+    ++length;
+}
+
+void IndexedLinkedList::prepend(const int value) {
+    const std::uint32_t slot = allocateSlot(value);
+    if (length == 0) {
+        head = tail = slot;
+    } else {
+        nextSlot[slot] = head;
+        head = slot;
+        compacted = false;
+    }
+    ++length;
+}
+
+void IndexedLinkedList::deleteLast() {
+    if (length == 0)
+        return;
+
+    if (length == 1) {
+        clear();
+        return;
+    }
+
+    if (compacted) {
+        // the node before the tail is simply the previous slot
+        values.pop_back();
+        nextSlot.pop_back();
+        tail = static_cast<std::uint32_t>(length - 2);
+        nextSlot[tail] = kNullSlot;
+        --length;
+        return;
+    }
+
+    std::uint32_t prev = head;
+    while (nextSlot[prev] != tail) {
+        prev = nextSlot[prev];
+    }
+    releaseSlot(tail);
+    tail = prev;
+    nextSlot[tail] = kNullSlot;
+    --length;
+}
+
+void IndexedLinkedList::deleteFirst() {
+    if (length == 0)
+        return;
+
+    if (length == 1) {
+        clear();
+        return;
+    }
+
+    const std::uint32_t temp = head;
+    head = nextSlot[head];
+    releaseSlot(temp);
+    compacted = false;
+    --length;
+}
+
+void IndexedLinkedList::deleteNode(const int index) {
+    if (index < 0 || index >= length)
+        return;
+
+    if (index == 0) {
+        deleteFirst();
+        return;
+    }
+
+    if (index == length - 1) {
+        deleteLast();
+        return;
+    }
+
+    const std::uint32_t prev = slotAt(index - 1);
+    const std::uint32_t target = nextSlot[prev];
+    nextSlot[prev] = nextSlot[target];
+    releaseSlot(target);
+    compacted = false;
+    --length;
+}
+
+int IndexedLinkedList::get(const int index) const {
+    if (index < 0 || index >= length)
+        return INT_MIN;
+    return values[slotAt(index)];
+}
+
+bool IndexedLinkedList::set(const int index, const int value) {
+    if (index < 0 || index >= length)
+        return false;
+    values[slotAt(index)] = value;
+    return true;
+}
+
+bool IndexedLinkedList::insert(const int index, const int value) {
+    if (index < 0 || index > length)
+        return false;
+
+    if (index == 0) {
+        prepend(value);
+        return true;
+    }
+
+    if (index == length) {
+        append(value);
+        return true;
+    }
+
+    const std::uint32_t prev = slotAt(index - 1);
+    const std::uint32_t slot = allocateSlot(value);
+    nextSlot[slot] = nextSlot[prev];
+    nextSlot[prev] = slot;
+    compacted = false;
+    ++length;
+    return true;
+}
+
+void IndexedLinkedList::reverse() {
+    if (length < 2)
+        return;
+
+    std::uint32_t before = kNullSlot;
+    std::uint32_t current = head;
+    while (current != kNullSlot) {
+        const std::uint32_t after = nextSlot[current];
+        nextSlot[current] = before;
+        before = current;
+        current = after;
+    }
+
+    std::swap(head, tail);
+    compacted = false;
+}
+
+void IndexedLinkedList::removeDuplicates() {
+    if (compacted) {
+        // keep the first occurrence of each value: a vectorised search of the
+        // already-kept prefix replaces the runner walk, and the survivors are
+        // packed down in place so the storage stays compact
+        std::size_t kept = 0;
+        for (std::size_t i = 0; i < values.size(); ++i) {
+            if (simd::find(values.data(), kept, values[i]) < 0) {
+                values[kept++] = values[i];
+            }
+        }
+        values.resize(kept);
+        nextSlot.resize(kept);
+        if (kept > 0) {
+            nextSlot[kept - 1] = kNullSlot;
+        }
+        length = static_cast<int>(kept);
+        tail = static_cast<std::uint32_t>(kept - 1);
+        return;
+    }
+
+    // same runner technique as LinkedList::removeDuplicates
+    for (std::uint32_t current = head; current != kNullSlot;
+         current = nextSlot[current]) {
+        std::uint32_t runner = current;
+        while (nextSlot[runner] != kNullSlot) {
+            const std::uint32_t candidate = nextSlot[runner];
+            if (values[candidate] == values[current]) {
+                nextSlot[runner] = nextSlot[candidate];
+                if (candidate == tail) {
+                    tail = runner;
+                }
+                releaseSlot(candidate);
+                compacted = false;
+                --length;
+            } else {
+                runner = candidate;
+            }
+        }
+    }
+}
+
+int IndexedLinkedList::binaryToDecimal() const {
+    if (compacted)
+        return simd::packBits(values.data(), values.size());
+
+    // unsigned so that lists longer than 31 bits wrap instead of overflowing
+    std::uint32_t num = 0;
+    for (std::uint32_t slot = head; slot != kNullSlot; slot = nextSlot[slot]) {
+        num = num * 2u + static_cast<std::uint32_t>(values[slot]);
+    }
+    return static_cast<int>(num);
+}
+
+void IndexedLinkedList::partitionList(const int limit) {
+    /*
+     * Same stable partition as LinkedList::partitionList. Since links are
+     * indices, the two partitions are tracked with head/tail slots instead
+     * of heap-allocated dummy nodes.
+     */
+    if (length < 2)
+        return;
+
+    if (compacted) {
+        // the vectorised count tells us where the ">= limit" group starts, so
+        // every value can be written straight to its final slot
+        std::size_t less = 0;
+        std::size_t greater = simd::countLess(values.data(), values.size(), limit);
+        std::vector<int> partitioned(values.size());
+        for (const int value : values) {
+            partitioned[value < limit ? less++ : greater++] = value;
+        }
+        values.swap(partitioned);
+        return;
+    }
+
+    std::uint32_t lessHead = kNullSlot;
+    std::uint32_t lessTail = kNullSlot;
+    std::uint32_t greaterHead = kNullSlot;
+    std::uint32_t greaterTail = kNullSlot;
+
+    std::uint32_t current = head;
+    while (current != kNullSlot) {
+        const std::uint32_t nextNode = nextSlot[current];
+        nextSlot[current] = kNullSlot;
+
+        if (values[current] < limit) {
+            if (lessTail == kNullSlot) {
+                lessHead = current;
+            } else {
+                nextSlot[lessTail] = current;
+            }
+            lessTail = current;
+        } else {
+            if (greaterTail == kNullSlot) {
+                greaterHead = current;
+            } else {
+                nextSlot[greaterTail] = current;
+            }
+            greaterTail = current;
+        }
+        current = nextNode;
+    }
+
+    if (lessTail == kNullSlot) {
+        head = greaterHead;
+        tail = greaterTail;
+        return;
+    }
+
+    nextSlot[lessTail] = greaterHead;
+    head = lessHead;
+    tail = greaterTail == kNullSlot ? lessTail : greaterTail;
+    // only stays in slot order if nothing actually moved
+    if (greaterTail != kNullSlot) {
+        compacted = false;
+    }
+}
+
+int IndexedLinkedList::indexOf(const int value) const {
+    if (compacted)
+        return static_cast<int>(simd::find(values.data(), values.size(), value));
+
+    int index = 0;
+    for (std::uint32_t slot = head; slot != kNullSlot; slot = nextSlot[slot]) {
+        if (values[slot] == value)
+            return index;
+        ++index;
+    }
+    return -1;
+}
+
+int IndexedLinkedList::countLess(const int limit) const {
+    if (compacted)
+        return static_cast<int>(
+            simd::countLess(values.data(), values.size(), limit));
+
+    int total = 0;
+    for (std::uint32_t slot = head; slot != kNullSlot; slot = nextSlot[slot]) {
+        total += values[slot] < limit ? 1 : 0;
+    }
+    return total;
+}
+
+int IndexedLinkedList::minValue() const {
+    // free slots hold stale values, so only compact storage can be scanned
+    // as a flat array
+    if (compacted)
+        return simd::minValue(values.data(), values.size());
+
+    int result = INT_MAX;
+    for (std::uint32_t slot = head; slot != kNullSlot; slot = nextSlot[slot]) {
+        result = values[slot] < result ? values[slot] : result;
+    }
+    return result;
+}
+
+int IndexedLinkedList::maxValue() const {
+    if (compacted)
+        return simd::maxValue(values.data(), values.size());
+
+    int result = INT_MIN;
+    for (std::uint32_t slot = head; slot != kNullSlot; slot = nextSlot[slot]) {
+        result = values[slot] > result ? values[slot] : result;
+    }
+    return result;
+}
+
+long long IndexedLinkedList::sum() const {
+    if (compacted)
+        return simd::sum(values.data(), values.size());
+
+    long long total = 0;
+    for (std::uint32_t slot = head; slot != kNullSlot; slot = nextSlot[slot]) {
+        total += values[slot];
+    }
+    return total;
+}
+
+void IndexedLinkedList::compact() {
+    if (compacted) {
+        values.shrink_to_fit();
+        nextSlot.shrink_to_fit();
+        return;
+    }
+
+    std::vector<int> orderedValues;
+    std::vector<std::uint32_t> orderedNext;
+    orderedValues.reserve(length);
+    orderedNext.reserve(length);
+
+    for (std::uint32_t slot = head; slot != kNullSlot; slot = nextSlot[slot]) {
+        orderedValues.push_back(values[slot]);
+        orderedNext.push_back(static_cast<std::uint32_t>(orderedNext.size() + 1));
+    }
+    orderedNext.back() = kNullSlot;
+
+    values.swap(orderedValues);
+    nextSlot.swap(orderedNext);
+    head = 0;
+    tail = static_cast<std::uint32_t>(length - 1);
+    freeList = kNullSlot;
+    compacted = true;
+}
+
+bool IndexedLinkedList::isCompact() const {
+    return compacted;
+}
+
+// Accessors
+
+int IndexedLinkedList::getLength() const {
+    return length;
+}
+
+std::size_t IndexedLinkedList::getCapacity() const {
+    return values.size();
+}
+
+std::size_t IndexedLinkedList::memoryUsage() const {
+    return values.capacity() * sizeof(int) +
+        nextSlot.capacity() * sizeof(std::uint32_t);
+}
+
+std::uint32_t IndexedLinkedList::getHeadSlot() const {
+    return head;
+}
+
+std::uint32_t IndexedLinkedList::getNextSlot(const std::uint32_t slot) const {
+    return nextSlot[slot];
+}
+
+// Stream Insertion Operator: same format as LinkedList
+std::ostream& operator<<(std::ostream& stream, const IndexedLinkedList& ll) {
+    stream << "{";
+    for (std::uint32_t slot = ll.head; slot != IndexedLinkedList::kNullSlot;
+         slot = ll.nextSlot[slot]) {
+        stream << ll.values[slot];
+        if (ll.nextSlot[slot] != IndexedLinkedList::kNullSlot)
+            stream << ", ";
+    }
+    stream << "}";
+    return stream;
+}
@@ -0,0 +1,102 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <vector>
+
+/*
+ * Singly linked list with index-based node storage.
+ *
+ * LinkedList heap-allocates every Node and links them with 64-bit pointers,
+ * so a node costs 16 bytes plus malloc overhead and consecutive nodes end up
+ * anywhere in the heap. Here all nodes live in the list's own storage and
+ * link to each other with 32-bit slot indices:
+ *
+ *     values[slot]   -> the node's data
+ *     nextSlot[slot] -> slot of the next node (kNullSlot for the tail)
+ *
+ * That is 8 bytes per node. The two fields are kept in parallel arrays so
+ * scans over the data (find, min/max, sums) only stream the values.
+ *
+ * Deleted slots go on a free list and are reused by later inserts. compact()
+ * renumbers the nodes in traversal order, after which slot i holds the i-th
+ * element and a traversal is a sequential walk through memory.
+ */
+class IndexedLinkedList {
+public:
+    static constexpr std::uint32_t kNullSlot = UINT32_MAX;
+
+    explicit IndexedLinkedList(int value);
+    ~IndexedLinkedList() = default;
+
+    IndexedLinkedList(const IndexedLinkedList& other) = default;
+    IndexedLinkedList& operator=(const IndexedLinkedList& other) = default;
+
+    IndexedLinkedList(IndexedLinkedList&& other) noexcept;
+    IndexedLinkedList& operator=(IndexedLinkedList&& other) noexcept;
+
+    void clear();
+
+    // 🚀 IndexedLinkedList APIs
+    void append(int value);
+    void prepend(int value);
+    void deleteLast();
+    void deleteFirst();
+    void deleteNode(int index);
+    int get(int index) const; // uses INT_MIN as sentinel value
+    bool set(int index, int value);
+    bool insert(int index, int value);
+    void reverse();
+    void removeDuplicates();
+    int binaryToDecimal() const;
+    void partitionList(int limit);
+
+    /*
+     * Whole-list scans. While the storage is compact the values are one
+     * contiguous array, so these run on the SIMD kernels in simdscan.hpp;
+     * otherwise they fall back to a scalar walk along the links.
+     */
+    int indexOf(int value) const; // -1 if not found
+    int countLess(int limit) const;
+    int minValue() const; // uses INT_MAX as sentinel value for an empty list
+    int maxValue() const; // uses INT_MIN as sentinel value for an empty list
+    long long sum() const;
+
+    /*
+     * Renumbers the nodes so that slot i holds the i-th element, drops the
+     * free list and releases unused capacity. O(n) time, O(n) scratch space.
+     */
+    void compact();
+
+    // true while slot i holds the i-th element for every i (no holes)
+    bool isCompact() const;
+
+    // 👀 Accessors
+    int getLength() const;
+    std::size_t getCapacity() const; // slots allocated, including free ones
+    std::size_t memoryUsage() const; // bytes reserved by the node storage
+
+    // 32-bit slot handles, mainly for tests and diagnostics
+    std::uint32_t getHeadSlot() const;
+    std::uint32_t getNextSlot(std::uint32_t slot) const;
+
+    friend std::ostream& operator<<(
+        std::ostream& stream,
+        const IndexedLinkedList& ll);
+
+private:
+    std::uint32_t slotAt(int index) const;
+    std::uint32_t allocateSlot(int value);
+    void releaseSlot(std::uint32_t slot);
+
+    std::vector<int> values;
+    std::vector<std::uint32_t> nextSlot;
+    std::uint32_t head;
+    std::uint32_t tail;
+    std::uint32_t freeList;
+    int length;
+    bool compacted;
+};
+
+std::ostream& operator<<(std::ostream& stream, const IndexedLinkedList& ll);
@@ -0,0 +1,356 @@
+#pragma once
+
+/*
+ * Intrusive doubly linked list.
+ *
+ * Unlike LinkedList / DoublyLinkedList, this list never allocates: the
+ * next/prev pointers (the "hook") live inside the user's own objects. An
+ * element type opts in by inheriting from ListHook<Tag>:
+ *
+ *     struct Timer : ListHook<> {
+ *         int deadline;
+ *     };
+ *
+ *     Timer a{}, b{};
+ *     IntrusiveList<Timer> timers;
+ *     timers.append(a);
+ *     timers.prepend(b);
+ *     timers.erase(a); // O(1), no lookup and no delete
+ *
+ * The list only links objects, it never owns them: the caller is responsible
+ * for keeping an element alive while it is linked. An object can be linked
+ * into several lists at once by inheriting one hook per list, each with its
+ * own Tag type.
+ */
+
+struct DefaultListTag {};
+
+template <typename Tag = DefaultListTag>
+class ListHook {
+public:
+    ListHook() = default;
+
+    // Copying an element must not copy its links
+    ListHook(const ListHook&) : next{nullptr}, prev{nullptr}, linked{false} {
+    }
+    ListHook& operator=(const ListHook&) {
+        return *this;
+    }
+
+    bool isLinked() const {
+        return linked;
+    }
+
+private:
+    template <typename T, typename U>
+    friend class IntrusiveList;
+
+    ListHook* next = nullptr;
+    ListHook* prev = nullptr;
+    bool linked = false;
+};
+
+template <typename T, typename Tag = DefaultListTag>
+class IntrusiveList {
+public:
+    using Hook = ListHook<Tag>;
+
+    IntrusiveList() = default;
+
+    // Unlinks every element; the elements themselves are left untouched
+    ~IntrusiveList() {
+        clear();
+    }
+
+    // A hook can only be in one list, so copying a list makes no sense
+    IntrusiveList(const IntrusiveList&) = delete;
+    IntrusiveList& operator=(const IntrusiveList&) = delete;
+
+    IntrusiveList(IntrusiveList&& other) noexcept
+        : head{other.head},
+          tail{other.tail},
+          length{other.length} {
+        other.head = other.tail = nullptr;
+        other.length = 0;
+    }
+
+    IntrusiveList& operator=(IntrusiveList&& other) noexcept {
+        if (this != &other) {
+            clear();
+            head = other.head;
+            tail = other.tail;
+            length = other.length;
+            other.head = other.tail = nullptr;
+            other.length = 0;
+        }
+        return *this;
+    }
+
+    void clear() {
+        Hook* current = head;
+        while (current != nullptr) {
+            Hook* next = current->next;
+            current->next = current->prev = nullptr;
+            current->linked = false;
+            current = next;
+        }
+        head = tail = nullptr;
+        length = 0;
+    }
+
+    // 🚀 IntrusiveList APIs
+
+    // Returns false (and does nothing) if the element is already linked
+    bool append(T& element) {
+        Hook* node = hookOf(element);
+        if (node->linked)
+            return false;
+
+        node->prev = tail;
+        node->next = nullptr;
+        if (tail == nullptr) {
+            head = node;
+        } else {
+            tail->next = node;
+        }
+        tail = node;
+        node->linked = true;
+        ++length;
+        return true;
+    }
+
+    bool prepend(T& element) {
+        Hook* node = hookOf(element);
+        if (node->linked)
+            return false;
+
+        node->next = head;
+        node->prev = nullptr;
+        if (head == nullptr) {
+            tail = node;
+        } else {
+            head->prev = node;
+        }
+        head = node;
+        node->linked = true;
+        ++length;
+        return true;
+    }
+
+    /*
+     * Unlinks the element in O(1) using its embedded prev/next pointers.
+     *
+     * The element must either be unlinked (no-op, returns false) or linked
+     * into *this* list; erasing an element that belongs to a different list
+     * of the same type corrupts both lists.
+     */
+    bool erase(T& element) {
+        Hook* node = hookOf(element);
+        if (!node->linked)
+            return false;
+
+        if (node->prev) {
+            node->prev->next = node->next;
+        } else {
+            head = node->next;
+        }
+
+        if (node->next) {
+            node->next->prev = node->prev;
+        } else {
+            tail = node->prev;
+        }
+
+        node->next = node->prev = nullptr;
+        node->linked = false;
+        --length;
+        return true;
+    }
+
+    // Removes and returns the first element, or nullptr if the list is empty
+    T* popFront() {
+        if (head == nullptr)
+            return nullptr;
+        T* element = elementOf(head);
+        erase(*element);
+        return element;
+    }
+
+    T* popBack() {
+        if (tail == nullptr)
+            return nullptr;
+        T* element = elementOf(tail);
+        erase(*element);
+        return element;
+    }
+
+    // Moves an element that is already in this list to the front, in O(1)
+    void moveToFront(T& element) {
+        erase(element);
+        prepend(element);
+    }
+
+    void moveToBack(T& element) {
+        erase(element);
+        append(element);
+    }
+
+    void reverse() {
+        // swapping every node's prev/next pointers reverses the list in place
+        Hook* current = head;
+        while (current != nullptr) {
+            Hook* next = current->next;
+            current->next = current->prev;
+            current->prev = next;
+            current = next;
+        }
+
+        Hook* temp = head;
+        head = tail;
+        tail = temp;
+    }
+
+    // swaps every two adjacent elements: 1->2->3->4->5 becomes 2->1->4->3->5
+    void swapPairs() {
+        Hook* first = head;
+
+        while (first != nullptr && first->next != nullptr) {
+            Hook* second = first->next;
+            Hook* before = first->prev;
+            Hook* after = second->next;
+
+            // re-link: before -> second -> first -> after
+            second->prev = before;
+            second->next = first;
+            first->prev = second;
+            first->next = after;
+
+            if (before) {
+                before->next = second;
+            } else {
+                head = second;
+            }
+
+            if (after) {
+                after->prev = first;
+            } else {
+                tail = first;
+            }
+
+            first = after;
+        }
+    }
+
+    /*
+     * Stable partition: all elements for which isLess(element) is true come
+     * before the rest, preserving the original relative order of both groups.
+     *
+     * Mirrors LinkedList::partitionList, but since the hook is embedded in the
+     * element there are no dummy nodes to allocate: the two partitions are
+     * tracked with plain head/tail pointers.
+     */
+    template <typename Predicate>
+    void partitionList(Predicate isLess) {
+        Hook* lessHead = nullptr;
+        Hook* lessTail = nullptr;
+        Hook* greaterHead = nullptr;
+        Hook* greaterTail = nullptr;
+
+        Hook* current = head;
+        while (current != nullptr) {
+            Hook* nextNode = current->next;
+            current->next = nullptr;
+
+            if (isLess(*elementOf(current))) {
+                current->prev = lessTail;
+                if (lessTail) {
+                    lessTail->next = current;
+                } else {
+                    lessHead = current;
+                }
+                lessTail = current;
+            } else {
+                current->prev = greaterTail;
+                if (greaterTail) {
+                    greaterTail->next = current;
+                } else {
+                    greaterHead = current;
+                }
+                greaterTail = current;
+            }
+
+            current = nextNode;
+        }
+
+        // connect the two partitions
+        if (lessTail == nullptr) {
+            head = greaterHead;
+            tail = greaterTail;
+            return;
+        }
+
+        lessTail->next = greaterHead;
+        if (greaterHead) {
+            greaterHead->prev = lessTail;
+        }
+        head = lessHead;
+        tail = greaterTail ? greaterTail : lessTail;
+    }
+
+    // 👀 Accessors
+    T* getHead() const {
+        return head ? elementOf(head) : nullptr;
+    }
+
+    T* getTail() const {
+        return tail ? elementOf(tail) : nullptr;
+    }
+
+    T* next(const T& element) const {
+        const Hook* node = hookOf(element);
+        return node->next ? elementOf(node->next) : nullptr;
+    }
+
+    T* prev(const T& element) const {
+        const Hook* node = hookOf(element);
+        return node->prev ? elementOf(node->prev) : nullptr;
+    }
+
+    int getLength() const {
+        return length;
+    }
+
+    bool empty() const {
+        return length == 0;
+    }
+
+    // Calls fn(element) for each element from head to tail
+    template <typename Function>
+    void forEach(Function fn) const {
+        for (Hook* current = head; current != nullptr;
+             current = current->next) {
+            fn(*elementOf(current));
+        }
+    }
+
+private:
+    static Hook* hookOf(T& element) {
+        return static_cast<Hook*>(&element);
+    }
+
+    static const Hook* hookOf(const T& element) {
+        return static_cast<const Hook*>(&element);
+    }
+
+    static T* elementOf(Hook* node) {
+        return static_cast<T*>(node);
+    }
+
+    static T* elementOf(const Hook* node) {
+        return static_cast<T*>(const_cast<Hook*>(node));
+    }
+
+    Hook* head = nullptr;
+    Hook* tail = nullptr;
+    int length = 0;
+};
@@ -0,0 +1,144 @@
+#include "latencyhistogram.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <sstream>
+#include <utility>
+
+namespace {
+
+constexpr std::uint64_t kLinearLimit = 1ULL << LatencyHistogram::kPrecisionBits;
+constexpr std::uint64_t kSubBuckets = kLinearLimit / 2;
+
+// position of the most significant set bit (value must be non-zero)
+int msb(const std::uint64_t value) {
+    return 63 - __builtin_clzll(value);
+}
+
+// enough buckets for the largest shift a 64-bit value can need
+constexpr std::size_t kBucketCount =
+    (64 - LatencyHistogram::kPrecisionBits + 2) * kSubBuckets;
+
+} // namespace
+
+LatencyHistogram::LatencyHistogram()
+    : buckets(kBucketCount, 0),
+      count{0},
+      minValue{UINT64_MAX},
+      maxValue{0},
+      total{0} {
+}
+
+std::size_t LatencyHistogram::bucketIndex(const std::uint64_t value) {
+    /*
+     * Below kLinearLimit: one bucket per value.
+     * Above it: drop `shift` low bits so the value keeps kPrecisionBits of
+     * precision; the remaining top bits lie in [kSubBuckets, kLinearLimit),
+     * and each shift level gets its own run of kSubBuckets buckets.
+     */
+    if (value < kLinearLimit)
+        return static_cast<std::size_t>(value);
+
+    const int shift = msb(value) - kPrecisionBits + 1;
+    return static_cast<std::size_t>(shift) * kSubBuckets +
+        static_cast<std::size_t>(value >> shift);
+}
+
+std::uint64_t LatencyHistogram::bucketUpperBound(const std::size_t index) {
+    if (index < kLinearLimit)
+        return index;
+
+    const std::size_t shift = index / kSubBuckets - 1;
+    const std::uint64_t sub = index - shift * kSubBuckets;
+    // ((sub + 1) << shift) - 1, without overflowing the very last bucket
+    return (sub << shift) + ((1ULL << shift) - 1);
+}
+
+void LatencyHistogram::record(const std::uint64_t value) {
+    recordMany(value, 1);
+}
+
+void LatencyHistogram::recordMany(
+    const std::uint64_t value,
+    const std::uint64_t times) {
+    if (times == 0)
+        return;
+    buckets[bucketIndex(value)] += times;
+    count += times;
+    total += static_cast<long double>(value) * times;
+    minValue = std::min(minValue, value);
+    maxValue = std::max(maxValue, value);
+}
+
+void LatencyHistogram::merge(const LatencyHistogram& other) {
+    for (std::size_t i = 0; i < buckets.size(); ++i) {
+        buckets[i] += other.buckets[i];
+    }
+    count += other.count;
+    total += other.total;
+    minValue = std::min(minValue, other.minValue);
+    maxValue = std::max(maxValue, other.maxValue);
+}
+
+void LatencyHistogram::reset() {
+    std::fill(buckets.begin(), buckets.end(), 0);
+    count = 0;
+    minValue = UINT64_MAX;
+    maxValue = 0;
+    total = 0;
+}
+
+std::uint64_t LatencyHistogram::getCount() const {
+    return count;
+}
+
+std::uint64_t LatencyHistogram::getMin() const {
+    return count == 0 ? 0 : minValue;
+}
+
+std::uint64_t LatencyHistogram::getMax() const {
+    return maxValue;
+}
+
+double LatencyHistogram::getMean() const {
+    return count == 0 ? 0.0 : static_cast<double>(total / count);
+}
+
+std::uint64_t LatencyHistogram::valueAtPercentile(double percentile) const {
+    if (count == 0)
+        return 0;
+
+    percentile = std::clamp(percentile, 0.0, 100.0);
+    // rank of the sample we are looking for (1-based)
+    std::uint64_t target = static_cast<std::uint64_t>(
+        std::ceil(percentile / 100.0 * static_cast<double>(count)));
+    target = std::max<std::uint64_t>(target, 1);
+
+    std::uint64_t seen = 0;
+    for (std::size_t i = 0; i < buckets.size(); ++i) {
+        seen += buckets[i];
+        if (seen >= target) {
+            // a bucket edge can overshoot the largest real sample
+            return std::min(bucketUpperBound(i), maxValue);
+        }
+    }
+    return maxValue;
+}
+
+std::string LatencyHistogram::toText(const std::string& unit) const {
+    std::ostringstream out;
+    out << "count=" << count << " min=" << getMin() << unit
+        << " mean=" << std::fixed << std::setprecision(1) << getMean() << unit
+        << '\n';
+    const std::pair<const char*, double> percentiles[] = {
+        {"p50", 50.0}, {"p90", 90.0}, {"p99", 99.0},
+        {"p99.9", 99.9}, {"p99.99", 99.99},
+    };
+    for (const auto& [label, p] : percentiles) {
+        out << "  " << std::setw(7) << std::left << label << std::right
+            << std::setw(12) << valueAtPercentile(p) << unit << '\n';
+    }
+    out << "  max    " << std::setw(12) << getMax() << unit << '\n';
+    return out.str();
+}
@@ -1,5 +1,172 @@
 #include "linkedlist.hpp"
 
+#include <algorithm>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <memory_resource>
+#include <new>
+
+#include "prefetch.hpp"
+
+#ifndef DS_VALIDATE_LISTS
+#define DS_VALIDATE_LISTS 0
+#endif
+
+namespace {
+
+#if DS_VALIDATE_LISTS
+/*
+ * Debug validation hook (ENABLE_LIST_VALIDATION): checks the O(1) invariants
+ * relating head, tail and length when a mutating API returns, on every return
+ * path, and aborts naming the API that broke them. Cheap enough to leave on
+ * for whole test runs; use isValid() for the full linear-pass check.
+ */
+class InvariantGuard {
+public:
+    InvariantGuard(const LinkedList& list, const char* api)
+        : list{list},
+          api{api} {
+    }
+
+    ~InvariantGuard() {
+        const Node* head = list.getHead();
+        const Node* tail = list.getTail();
+        const int length = list.getLength();
+
+        const char* problem = nullptr;
+        if (length < 0)
+            problem = "negative length";
+        else if ((length == 0) != (head == nullptr) || (head == nullptr) != (tail == nullptr))
+            problem = "head, tail and length disagree about emptiness";
+        else if (tail != nullptr && tail->getNext() != nullptr)
+            problem = "tail has a successor";
+        else if (length == 1 && head != tail)
+            problem = "single-node list with head != tail";
+
+        if (problem) {
+            std::cerr << "LinkedList invariant violated after " << api << "(): " << problem
+                      << "\n";
+            std::abort();
+        }
+    }
+
+    InvariantGuard(const InvariantGuard&) = delete;
+    InvariantGuard& operator=(const InvariantGuard&) = delete;
+
+private:
+    const LinkedList& list;
+    const char* api;
+};
+#else
+class InvariantGuard {
+public:
+    InvariantGuard(const LinkedList&, const char*) {
+    }
+};
+#endif
+
+} // namespace
+
+/*
+ * Node blocks owned by the list, filled by defragment()/defragmentStep().
+ *
+ * A relocated node lives in a block rather than in its own allocation, so
+ * destroyNode() only decrements its block's live count, and the block is
+ * freed when the count reaches zero. Blocks are kept sorted by address so
+ * that lookup is a binary search. The state and its block index come from
+ * the list's resource like the nodes do, so a pmr-backed list never touches
+ * the global heap. Arena lists are the exception: the list may outlive its
+ * arena, and clear() still reaches the state from the destructor, so their
+ * state and index live on the global heap (the blocks still come from the
+ * arena).
+ */
+struct LinkedList::DefragState {
+    struct Block {
+        Node* nodes;
+        int capacity;
+        int used; // slots handed out so far, in list order
+        int live; // slots still holding a node of the list
+    };
+
+    DefragState(std::pmr::memory_resource* resource, std::pmr::memory_resource* home)
+        : resource{resource},
+          home{home},
+          blocks(home ? home : std::pmr::new_delete_resource()) {
+    }
+
+    // `inArena`: keep the state itself off `resource` (see above)
+    static DefragState* create(std::pmr::memory_resource* resource, const bool inArena) {
+        if (resource && !inArena) {
+            return new (resource->allocate(sizeof(DefragState), alignof(DefragState)))
+                DefragState(resource, resource);
+        }
+        return new DefragState(resource, nullptr);
+    }
+
+    // The block holding `node`, or nullptr if the node has its own allocation
+    Block* findBlock(const Node* node) {
+        const auto after = std::upper_bound(blocks.begin(), blocks.end(), node,
+                                            [](const Node* target, const Block& block) {
+                                                return std::less<const Node*>{}(target, block.nodes);
+                                            });
+        if (after == blocks.begin())
+            return nullptr;
+        Block& block = *(after - 1);
+        return std::less<const Node*>{}(node, block.nodes + block.used) ? &block : nullptr;
+    }
+
+    // The block the current pass is filling (possibly still empty)
+    Block& fillBlock() {
+        return *std::lower_bound(blocks.begin(), blocks.end(), filling,
+                                 [](const Block& block, const Node* target) {
+                                     return std::less<const Node*>{}(block.nodes, target);
+                                 });
+    }
+
+    void addBlock(const int capacity) {
+        const std::size_t bytes = static_cast<std::size_t>(capacity) * sizeof(Node);
+        void* memory = resource ? resource->allocate(bytes, alignof(Node))
+                                : ::operator new(bytes);
+        const Block block{static_cast<Node*>(memory), capacity, 0, 0};
+        const auto position = std::upper_bound(blocks.begin(), blocks.end(), block,
+                                               [](const Block& left, const Block& right) {
+                                                   return std::less<const Node*>{}(left.nodes, right.nodes);
+                                               });
+        blocks.insert(position, block);
+        filling = block.nodes;
+    }
+
+    // Frees `block` and drops it from the index
+    void freeBlock(Block& block) {
+        const std::size_t bytes = static_cast<std::size_t>(block.capacity) * sizeof(Node);
+        if (resource) {
+            resource->deallocate(block.nodes, bytes, alignof(Node));
+        } else {
+            ::operator delete(block.nodes);
+        }
+        blocks.erase(blocks.begin() + (&block - blocks.data()));
+    }
+
+    std::pmr::memory_resource* const resource; // blocks come from here; nullptr: global heap
+    std::pmr::memory_resource* const home; // the state and `blocks`; nullptr: global heap
+    std::pmr::vector<Block> blocks; // sorted by address
+    const Node* filling = nullptr; // first slot of the block the current pass fills
+    Node* cursor = nullptr; // last node placed by the current pass
+    int placed = 0; // nodes placed by the current pass
+    bool active = false;
+};
+
+void LinkedList::DefragDeleter::operator()(DefragState* state) const {
+    std::pmr::memory_resource* home = state->home;
+    if (home) {
+        state->~DefragState();
+        home->deallocate(state, sizeof(DefragState), alignof(DefragState));
+        return;
+    }
+    delete state;
+}
+
 Node::Node(int data)
     : data{data},
       next{nullptr} {
@@ -21,14 +188,69 @@ void Node::setData(int data) {
     this->data = data;
 }
 
+// Node allocation: every node the list owns is created and destroyed here
+Node* LinkedList::createNode(const int value) {
+    stats.recordAllocation(sizeof(Node));
+    if (resource) {
+        return new (resource->allocate(sizeof(Node), alignof(Node))) Node(value);
+    }
+    return new Node(value);
+}
+
+void LinkedList::destroyNode(Node* node) {
+    // Node is trivially destructible and a monotonic arena ignores
+    // deallocate(), so arena nodes are simply dropped
+    if (releaseInBulk)
+        return;
+
+    if (defrag) {
+        if (DefragState::Block* block = defrag->findBlock(node)) {
+            // relocated node: give its slot back, and the block once it is empty
+            if (--block->live == 0) {
+                stats.recordDeallocation(static_cast<std::size_t>(block->capacity) * sizeof(Node));
+                defrag->freeBlock(*block);
+            }
+            return;
+        }
+    }
+
+    stats.recordDeallocation(sizeof(Node));
+    if (resource) {
+        node->~Node();
+        resource->deallocate(node, sizeof(Node), alignof(Node));
+        return;
+    }
+    delete node;
+}
+
 void LinkedList::clear() {
+    invalidateDefrag();
+    if (releaseInBulk) {
+        // nothing to free node by node: the arena reclaims it all at once
+        head = tail = nullptr;
+        length = 0;
+        defrag.reset();
+        return;
+    }
+
+    // a cycle closed from the tail (tail->setNext(...)) would make the walk
+    // below free nodes twice: cut it first. One closed mid-list leaves
+    // tail->next null and costs a full scan to find, so only validation
+    // builds look for it; elsewhere the caller must breakLoop() first
+#if DS_VALIDATE_LISTS
+    breakLoop();
+#else
+    if (tail != nullptr && tail->getNext() != nullptr)
+        breakLoop();
+#endif
+
     Node* current = head;
     // check if the current Node is not a nullptr
     while (current != nullptr) {
         // get the next node
         Node* next = current->getNext();
         // delete the current node
-        delete current;
+        destroyNode(current);
         // make the next node the current one
         current = next;
     }
@@ -37,11 +259,31 @@ void LinkedList::clear() {
     length = 0;
 }
 
-LinkedList::LinkedList(int value) {
+LinkedList::LinkedList(std::pmr::memory_resource* resource)
+    : head{nullptr},
+      tail{nullptr},
+      length{0},
+      releaseInBulk{false},
+      resource{resource} {
+}
+
+LinkedList::LinkedList(const int value, std::pmr::memory_resource* resource)
+    : releaseInBulk{false},
+      resource{resource} {
     // create a new Node (first node)
-    head = new Node(value);
+    head = createNode(value);
+    tail = head;
+    length = 1;
+    stats.recordInsert(length);
+}
+
+LinkedList::LinkedList(const int value, std::pmr::monotonic_buffer_resource& arena)
+    : releaseInBulk{true},
+      resource{&arena} {
+    head = createNode(value);
     tail = head;
     length = 1;
+    stats.recordInsert(length);
 }
 
 LinkedList::~LinkedList() {
@@ -64,7 +306,9 @@ void LinkedList::append(const int value) {
         * - value: The integer data to store in the newly appended node.
     */
 
-    Node* newNode = new Node(value);
+    const InvariantGuard guard(*this, __func__);
+
+    Node* newNode = createNode(value);
     if (length == 0) {
         // LinkedList is empty
         head = newNode;
@@ -75,6 +319,7 @@ void LinkedList::append(const int value) {
         tail = newNode;
     }
     ++length;
+    stats.recordInsert(length);
 }
 
 void LinkedList::prepend(const int value) {
@@ -88,8 +333,10 @@ void LinkedList::prepend(const int value) {
      *
      * Increments the list length after insertion.
      */
+    invalidateDefrag();
+    const InvariantGuard guard(*this, __func__);
 
-    Node* newNode = new Node(value);
+    Node* newNode = createNode(value);
 
     if (length == 0) {
         // Empty list: new node is both head and tail
@@ -101,6 +348,7 @@ void LinkedList::prepend(const int value) {
     }
 
     ++length;
+    stats.recordInsert(length);
 }
 
 
@@ -121,9 +369,13 @@ void LinkedList::deleteLast() {
      * 3. The list has two or more nodes — iterate to the second-to-last node,
      *    update tail, and disconnect the last node.
      */
+    invalidateDefrag();
+    const InvariantGuard guard(*this, __func__);
 
-    if (length == 0)
+    if (length == 0) {
+        stats.recordEmptyRemoval();
         return; // Case 1: list is empty
+    }
 
     Node* temp = head;
 
@@ -140,10 +392,12 @@ void LinkedList::deleteLast() {
         }
         tail = prev;
         tail->setNext(nullptr);
+        stats.recordTraversal(length - 1);
     }
 
-    delete temp;
+    destroyNode(temp);
     --length;
+    stats.recordRemoval();
 }
 
 void LinkedList::deleteFirst() {
@@ -164,9 +418,13 @@ void LinkedList::deleteFirst() {
      *
      * Frees the memory occupied by the removed node and updates the list length.
      */
+    invalidateDefrag();
+    const InvariantGuard guard(*this, __func__);
 
-    if (length == 0)
+    if (length == 0) {
+        stats.recordEmptyRemoval();
         return; // Case 1: empty list
+    }
 
     Node* temp = head;
 
@@ -179,8 +437,9 @@ void LinkedList::deleteFirst() {
         head = head->getNext();
     }
 
-    delete temp;
+    destroyNode(temp);
     --length;
+    stats.recordRemoval();
 }
 
 
@@ -198,6 +457,8 @@ void LinkedList::deleteNode(const int index) {
      *
      * No action is taken if the index is invalid.
      */
+    invalidateDefrag();
+    const InvariantGuard guard(*this, __func__);
 
     if (index < 0 || index >= length)
         return;
@@ -217,8 +478,9 @@ void LinkedList::deleteNode(const int index) {
     Node* target = prev->getNext();
 
     prev->setNext(target->getNext());
-    delete target;
+    destroyNode(target);
     --length;
+    stats.recordRemoval();
 }
 
 
@@ -241,7 +503,9 @@ Node* LinkedList::get(const int index) const {
     Node* result = head;
     for (int i = 0; i < index; ++i) {
         result = result->getNext();
+        prefetchForRead(result->getNext()); // the node after next
     }
+    stats.recordLookup(index);
     return result;
 }
 
@@ -289,6 +553,8 @@ bool LinkedList::insert(const int index, const int value) {
         * - true if the insertion was successful.
         * - false if the index is out of bounds.
      */
+    invalidateDefrag();
+    const InvariantGuard guard(*this, __func__);
 
     if (index < 0 || index > length)
         return false;
@@ -304,11 +570,12 @@ bool LinkedList::insert(const int index, const int value) {
     }
 
     // Insert in the middle
-    Node* newNode = new Node(value);
+    Node* newNode = createNode(value);
     Node* prev = get(index - 1);
     newNode->setNext(prev->getNext());
     prev->setNext(newNode);
     ++length;
+    stats.recordInsert(length);
 
     return true;
 }
@@ -322,6 +589,9 @@ void LinkedList::reverse() {
      *  - use a for loop that runs through the length of the linked list to perform the reversal of pointer direction
      * */
 
+    invalidateDefrag();
+    const InvariantGuard guard(*this, __func__);
+
     // step 1: switch head and tail node pointers
     Node* temp = head;
     head = tail;
@@ -333,6 +603,7 @@ void LinkedList::reverse() {
 
     for (int i = 0; i < length; i++) {
         after = temp->getNext(); // Store next node
+        prefetchForWrite(after); // start its miss before we write to temp
         temp->setNext(before); // Reverse the link
         before = temp; // Move before forward
         temp = after; // Move temp forward
@@ -370,6 +641,111 @@ bool LinkedList::hasLoop() const {
     return false;
 }
 
+Node* LinkedList::findLoopStart() const {
+    /*
+     * Floyd, phase two: once slow and fast meet inside the cycle, the meeting
+     * point and the head are the same distance from the cycle's entry, so
+     * stepping one pointer from each in lockstep lands both on the entry.
+     */
+    Node* slow = head;
+    Node* fast = head;
+
+    while (fast != nullptr && fast->getNext() != nullptr) {
+        slow = slow->getNext();
+        fast = fast->getNext()->getNext();
+        if (slow == fast) {
+            slow = head;
+            while (slow != fast) {
+                slow = slow->getNext();
+                fast = fast->getNext();
+            }
+            return slow;
+        }
+    }
+    return nullptr;
+}
+
+int LinkedList::loopLength() const {
+    /*
+     * Brent: the hare runs ahead in stretches of doubling length and the
+     * tortoise teleports to it after each stretch. Inside the cycle the hare
+     * comes back to the tortoise after exactly `cycle length` steps, once a
+     * stretch is long enough, so the count is the answer. Fewer `next` loads
+     * than Floyd, O(1) memory.
+     */
+    if (head == nullptr)
+        return 0;
+
+    const Node* tortoise = head;
+    const Node* hare = head->getNext();
+    int power = 1;
+    int lambda = 1;
+    while (hare != tortoise) {
+        if (hare == nullptr)
+            return 0;
+        if (power == lambda) {
+            tortoise = hare;
+            power *= 2;
+            lambda = 0;
+        }
+        hare = hare->getNext();
+        ++lambda;
+    }
+    return lambda;
+}
+
+bool LinkedList::breakLoop(int* lostNodes) {
+    /*
+     * Cuts the link that closes the cycle, so the node before the entry (in
+     * cycle order) becomes the tail, then recounts the length. When the cycle
+     * was closed from the tail nothing is lost. When it was closed from a node
+     * in the middle, the old successors of that node (up to the old tail) are
+     * no longer reachable from any pointer the list holds, so they leak; the
+     * drop in length is how many.
+     */
+    if (lostNodes != nullptr)
+        *lostNodes = 0;
+    Node* start = findLoopStart();
+    if (start == nullptr)
+        return false;
+
+    invalidateDefrag();
+    Node* last = start;
+    while (last->getNext() != start)
+        last = last->getNext();
+    last->setNext(nullptr);
+    tail = last;
+
+    const int recorded = length;
+    length = 0;
+    for (const Node* node = head; node != nullptr; node = node->getNext())
+        ++length;
+    if (lostNodes != nullptr)
+        *lostNodes = std::max(recorded - length, 0);
+    return true;
+}
+
+bool LinkedList::isValid() const {
+    /*
+     * One pass, O(1) memory. Walking at most `length` nodes both counts them
+     * and bounds the walk: a correct list ends at exactly `tail` after
+     * `length` nodes, and a cycle can only show up as a non-null link out of
+     * the last counted node, so no separate cycle detection is needed.
+     */
+    if (length < 0)
+        return false;
+    if (length == 0)
+        return head == nullptr && tail == nullptr;
+
+    const Node* current = head;
+    for (int i = 1; i < length; ++i) {
+        if (current == nullptr)
+            return false;
+        current = current->getNext();
+    }
+    return current != nullptr && current == tail && current->getNext() == nullptr;
+}
+
 // find the Kth node from the end
 Node* LinkedList::findKthFromEnd(int k) const {
     if (k < 1)
@@ -383,12 +759,17 @@ Node* LinkedList::findKthFromEnd(int k) const {
         if (fast == nullptr)
             return nullptr; // K > length of linkedlist
         fast = fast->getNext();
+        if (fast)
+            prefetchForRead(fast->getNext());
     }
 
     // step 2: Mover both slow and faster pointers until fast reaches the end (nullptr)
+    // ('slow' only revisits nodes 'fast' has already pulled into cache)
     while (fast != nullptr) {
         slow = slow->getNext();
         fast = fast->getNext();
+        if (fast)
+            prefetchForRead(fast->getNext());
     }
 
     // slow pointer now points to the kth node
@@ -397,6 +778,8 @@ Node* LinkedList::findKthFromEnd(int k) const {
 
 // find and delete nodes with duplicate value
 void LinkedList::removeDuplicates() {
+    invalidateDefrag();
+    const InvariantGuard guard(*this, __func__);
     if (head == nullptr)
         return;
 
@@ -409,8 +792,9 @@ void LinkedList::removeDuplicates() {
                 // duplicate found: delete the node
                 Node* duplicate = runner->getNext();
                 runner->setNext(duplicate->getNext());
-                delete duplicate;
+                destroyNode(duplicate);
                 --length;
+                stats.recordRemoval();
             } else {
                 runner = runner->getNext();
             }
@@ -469,13 +853,15 @@ void LinkedList::partitionList(const int limit) {
      * - Original nodes are reused (no new data allocation).
      * - This method ensures O(n) time and O(1) extra space (excluding dummy pointers).
      */
+    invalidateDefrag();
+    const InvariantGuard guard(*this, __func__);
 
     if (head == nullptr)
         return;
 
     // Dummy heads for two new partitions
-    Node* lessHead = new Node(0); // Holds nodes < limit
-    Node* greaterHead = new Node(0); // Holds nodes >= limit
+    Node* lessHead = createNode(0); // Holds nodes < limit
+    Node* greaterHead = createNode(0); // Holds nodes >= limit
 
     // Tails to append nodes to the above dummy heads
     Node* lessTail = lessHead;
@@ -509,8 +895,8 @@ void LinkedList::partitionList(const int limit) {
     tail = greaterTail;
 
     // Clean up dummy nodes
-    delete lessHead;
-    delete greaterHead;
+    destroyNode(lessHead);
+    destroyNode(greaterHead);
 }
 
 
@@ -523,11 +909,13 @@ void LinkedList::reverseBetween(int m, int n) {
      * The algorithm uses a dummy node to simplify edge cases,
      * especially when m = 0 (reversing from the head).
      */
+    invalidateDefrag();
+    const InvariantGuard guard(*this, __func__);
 
     if (!head || m == n)
         return;
 
-    Node* dummy = new Node(0);
+    Node* dummy = createNode(0);
     dummy->setNext(head);
 
     Node* prev = dummy;
@@ -557,7 +945,7 @@ void LinkedList::reverseBetween(int m, int n) {
         temp = temp->getNext();
     tail = temp;
 
-    delete dummy;
+    destroyNode(dummy);
 }
 
 // swap pairs of nodes
@@ -570,6 +958,8 @@ void LinkedList::swapPairs() {
      */
     if (!head || !head->getNext())
         return;
+    invalidateDefrag();
+    const InvariantGuard guard(*this, __func__);
 
     /*
      * 2. Dummy Node Initialization:
@@ -577,7 +967,7 @@ void LinkedList::swapPairs() {
      *    - This simplifies edge cases when swapping the first pair (i.e., involving the head).
      *    - 'prev' pointer starts at dummy and will help re-link swapped nodes.
      */
-    Node* dummy = new Node(0);
+    Node* dummy = createNode(0);
     dummy->setNext(head);
     Node* prev = dummy;
 
@@ -625,7 +1015,96 @@ void LinkedList::swapPairs() {
      *    - Delete the  dummy node to prevent memory leak.
      */
 
-    delete dummy;
+    destroyNode(dummy);
+}
+
+// Defragmentation
+
+void LinkedList::invalidateDefrag() {
+    if (defrag)
+        defrag->active = false;
+}
+
+// Copies `node` into the next free block slot and unlinks the original
+Node* LinkedList::relocate(Node* node, Node* predecessor) {
+    if (defrag->fillBlock().used == defrag->fillBlock().capacity) {
+        // the list grew during the pass: continue in a new block
+        const int capacity = std::max(length - defrag->placed, 1);
+        defrag->addBlock(capacity);
+        stats.recordAllocation(static_cast<std::size_t>(capacity) * sizeof(Node));
+    }
+    DefragState::Block& block = defrag->fillBlock();
+    Node* moved = new (block.nodes + block.used) Node(node->getData());
+    ++block.used;
+    ++block.live;
+
+    moved->setNext(node->getNext());
+    if (predecessor) {
+        predecessor->setNext(moved);
+    } else {
+        head = moved;
+    }
+    if (tail == node)
+        tail = moved;
+
+    destroyNode(node);
+    ++defrag->placed;
+    return moved;
+}
+
+void LinkedList::defragment() {
+    invalidateDefrag(); // always start a fresh, complete pass
+    defragmentStep(length);
+}
+
+bool LinkedList::defragmentStep(const int maxNodes) {
+    /*
+     * A pass walks the list from the head, copying each node into a block
+     * sized for the whole list, so after the pass the nodes are contiguous in
+     * traversal order. `cursor` remembers the last node placed, letting the
+     * next call resume there. Structural edits other than append() reset the
+     * pass (see invalidateDefrag()), since they could unlink the cursor or
+     * put old nodes in front of it.
+     */
+    const InvariantGuard guard(*this, __func__);
+    if (length == 0) {
+        invalidateDefrag();
+        return true;
+    }
+    if (maxNodes <= 0)
+        return false;
+
+    if (!defrag) {
+        defrag.reset(DefragState::create(resource, releaseInBulk));
+    }
+    if (!defrag->active) {
+        defrag->active = true;
+        defrag->cursor = nullptr;
+        defrag->placed = 0;
+        defrag->addBlock(length);
+        stats.recordAllocation(static_cast<std::size_t>(length) * sizeof(Node));
+    }
+
+    Node* predecessor = defrag->cursor;
+    Node* current = predecessor ? predecessor->getNext() : head;
+    for (int moved = 0; current && moved < maxNodes; ++moved) {
+        predecessor = relocate(current, predecessor);
+        current = predecessor->getNext();
+    }
+    defrag->cursor = predecessor;
+
+    if (current)
+        return false;
+    defrag->active = false;
+    return true;
+}
+
+bool LinkedList::isContiguous() const {
+    for (const Node* node = head; node && node->getNext(); node = node->getNext()) {
+        if (node->getNext() != node + 1)
+            return false;
+    }
+    return true;
 }
 
 // Accessors and Mutators
@@ -641,15 +1120,26 @@ int LinkedList::getLength() const {
     return length;
 }
 
+bool LinkedList::isArenaBacked() const {
+    return releaseInBulk;
+}
+
+std::pmr::memory_resource* LinkedList::getResource() const {
+    return resource;
+}
+
 void LinkedList::setHead(Node* node) {
+    invalidateDefrag();
     head = node;
 }
 
 void LinkedList::setTail(Node* node) {
+    invalidateDefrag();
     tail = node;
 }
 
 void LinkedList::setLength(int len) {
+    invalidateDefrag();
     length = len;
 }
 
@@ -661,24 +1151,35 @@ void LinkedList::decrementLength() {
     --length;
 }
 
+StatsSnapshot LinkedList::getStats() const {
+    return stats.snapshot();
+}
+
+void LinkedList::resetStats() {
+    stats.reset();
+}
+
 // copy constructor
-LinkedList::LinkedList(const LinkedList& other) {
-    //
+LinkedList::LinkedList(const LinkedList& other)
+    // like a std::pmr container, a copy does not inherit the source's resource
+    : releaseInBulk{false},
+      resource{nullptr} {
     if (other.head == nullptr) {
         head = nullptr;
         tail = nullptr;
         length = 0;
     } else {
-        head = new Node(other.head->getData());
+        head = createNode(other.head->getData());
         Node* current = head;
         Node* otherCurrent = other.head->getNext();
         while (otherCurrent != nullptr) {
-            current->setNext(new Node(otherCurrent->getData()));
+            current->setNext(createNode(otherCurrent->getData()));
             current = current->getNext();
             otherCurrent = otherCurrent->getNext();
         }
         tail = current;
         length = other.length;
+        stats.recordLength(length);
     }
 }
 
@@ -691,16 +1192,17 @@ LinkedList& LinkedList::operator=(const LinkedList& other) {
         head = tail = nullptr;
         length = 0;
     } else {
-        head = new Node(other.head->getData());
+        head = createNode(other.head->getData());
         Node* current = head;
         Node* otherCurrent = other.head->getNext();
         while (otherCurrent != nullptr) {
-            current->setNext(new Node(otherCurrent->getData()));
+            current->setNext(createNode(otherCurrent->getData()));
             current = current->getNext();
             otherCurrent = otherCurrent->getNext();
         }
         tail = current;
         length = other.length;
+        stats.recordLength(length);
     }
 
     return *this;
@@ -711,7 +1213,10 @@ LinkedList& LinkedList::operator=(const LinkedList& other) {
 LinkedList::LinkedList(LinkedList&& other) noexcept
     : head(other.head),
       tail(other.tail),
-      length(other.length) {
+      length(other.length),
+      releaseInBulk(other.releaseInBulk),
+      resource(other.resource),
+      defrag(std::move(other.defrag)) {
     other.head = other.tail = nullptr;
     other.length = 0;
 }
@@ -721,9 +1226,13 @@ LinkedList& LinkedList::operator=(LinkedList&& other) noexcept {
     if (this != &other) {
         clear();
     }
+    // the nodes keep living where they were allocated, so their resource comes along
     head = other.head;
     tail = other.tail;
     length = other.length;
+    resource = other.resource;
+    releaseInBulk = other.releaseInBulk;
+    defrag = std::move(other.defrag); // its blocks hold other's nodes
     other.head = other.tail = nullptr;
     other.length = 0;
 
@@ -737,8 +1246,18 @@ std::ostream& operator<<(std::ostream& stream, const LinkedList& ll) {
         stream << "{}"; // Output nothing for empty list
     } else {
         stream << "{";
+        // a cyclic list is printed up to the second visit of the cycle entry
+        const Node* loopStart = ll.findLoopStart();
+        bool enteredLoop = false;
         Node* current = ll.getHead();
         while (current != nullptr) {
+            if (current == loopStart) {
+                if (enteredLoop) {
+                    stream << "...";
+                    break;
+                }
+                enteredLoop = true;
+            }
             stream << current->getData();
             current = current->getNext();
             if (current)
@@ -758,15 +1277,7 @@ std::istream& operator>>(std::istream& stream, LinkedList& ll) {
     // Read integers and append to the list
     int value;
     while (stream >> value) {
-        Node* newNode = new Node(value);
-        if (ll.getHead() == nullptr) {
-            ll.setHead(newNode);
-            ll.setTail(newNode);
-        } else {
-            ll.getTail()->setNext(newNode);
-            ll.setTail(newNode);
-        }
-        ll.incrementLength();
+        ll.append(value);
     }
 
     // Clear fail state if eof is not reached (e.g., non-integer input)
@@ -1,6 +1,10 @@
 #pragma once
 
 #include <istream>
+#include <memory>
+#include <memory_resource>
+
+#include "containerstats.hpp"
 
 
 class Node {
@@ -23,13 +27,29 @@ private:
 
 class LinkedList {
 public:
-    explicit LinkedList(int value);
+    /*
+     * Nodes are allocated from `resource` (a pool, monotonic or NUMA-local
+     * std::pmr::memory_resource) when one is given, and with plain new/delete
+     * otherwise. The resource must outlive the list.
+     */
+    explicit LinkedList(std::pmr::memory_resource* resource = nullptr); // empty list
+    explicit LinkedList(int value, std::pmr::memory_resource* resource = nullptr);
+
+    /*
+     * Arena mode: every node is bump-allocated from `arena`, and removing or
+     * clearing nodes never frees them one by one. clear() and the destructor
+     * just forget the nodes in O(1); their memory comes back when the caller
+     * releases (or destroys) the arena. Meant for lists that are built,
+     * traversed a few times and thrown away. The arena must outlive any use
+     * of the list's nodes, but the list may safely be destroyed after it.
+     */
+    LinkedList(int value, std::pmr::monotonic_buffer_resource& arena);
 
     ~LinkedList();
 
-    void clear(); // For safe clearing of nodes
+    void clear(); // For safe clearing of nodes (O(1) in arena mode)
 
-    LinkedList(const LinkedList& other); // Copy constructor
+    LinkedList(const LinkedList& other); // Copy constructor (always heap-backed)
     LinkedList& operator=(const LinkedList& other); // Copy assignment
 
     LinkedList(LinkedList&& other) noexcept; // Move constructor
@@ -59,6 +79,29 @@ public:
     // Floyd's cycle-finding algorithm (aka "tortoise and the hare" algorithm)
     bool hasLoop() const;
 
+    // Node where the cycle begins, nullptr if the list ends (Floyd)
+    Node* findLoopStart() const;
+
+    // Number of nodes on the cycle, 0 if the list ends (Brent)
+    int loopLength() const;
+
+    /*
+     * Cuts the cycle, if any, and fixes tail and length. Returns false if
+     * acyclic. A cycle closed in the middle of the list (some node relinked to
+     * an earlier one) cuts off the nodes that used to follow it; nothing links
+     * to them any more, so they cannot be freed and leak. Their number (recorded
+     * length minus the new length) is stored in *lostNodes when given.
+     */
+    bool breakLoop(int* lostNodes = nullptr);
+
+    /*
+     * Full integrity check in one pass with O(1) memory: the list is acyclic,
+     * holds exactly `length` nodes and ends at `tail`. Debug builds configured
+     * with -DENABLE_LIST_VALIDATION=ON also run a cheap O(1) check of head,
+     * tail and length after every mutating API and abort on corruption.
+     */
+    bool isValid() const;
+
     Node* findKthFromEnd(int k) const;
 
     void removeDuplicates();
@@ -71,10 +114,29 @@ public:
 
     void swapPairs();
 
+    // 🧹 Defragmentation
+    /*
+     * Rewrites every node into one contiguous block in list order, so a list
+     * scattered by long use traverses like a freshly built one. O(n). Node
+     * pointers obtained earlier (get, getHead, ...) are invalidated.
+     */
+    void defragment();
+    /*
+     * Incremental defragment(): relocates at most maxNodes more nodes, picking
+     * up where the previous call stopped, so the work can be spread over idle
+     * slices. Returns true once the whole list has been relocated. Appends
+     * between steps are fine; any other structural change restarts the pass.
+     */
+    bool defragmentStep(int maxNodes);
+    // Every node sits right after its predecessor in memory
+    bool isContiguous() const;
+
     // 👀 Accessors
     Node* getHead() const;
     Node* getTail() const;
     int getLength() const;
+    bool isArenaBacked() const;
+    std::pmr::memory_resource* getResource() const; // nullptr: global heap
 
     // 🔧 Mutators
     void setHead(Node* node);
@@ -85,14 +147,33 @@ public:
     void incrementLength();
     void decrementLength();
 
+    // 📊 Usage counters (all zero unless built with ENABLE_CONTAINER_STATS)
+    StatsSnapshot getStats() const;
+    void resetStats();
+
     // Friend declarations for stream operators
     friend std::ostream& operator<<(std::ostream& stream, const LinkedList& ll);
     friend std::istream& operator>>(std::istream& stream, const LinkedList& ll);
 
 private:
+    struct DefragState;
+    // Frees the state through the resource it was allocated from
+    struct DefragDeleter {
+        void operator()(DefragState* state) const;
+    };
+
+    Node* createNode(int value);
+    void destroyNode(Node* node);
+    Node* relocate(Node* node, Node* predecessor);
+    void invalidateDefrag();
+
     Node* head;
     Node* tail;
     int length;
+    bool releaseInBulk; // arena mode: nodes are never freed one by one
+    std::pmr::memory_resource* resource; // nullptr: new/delete
+    std::unique_ptr<DefragState, DefragDeleter> defrag; // created by the first defragment call
+    [[no_unique_address]] mutable ContainerStats stats;
 };
 
 std::ostream& operator<<(std::ostream& stream, const LinkedList& ll);
@@ -0,0 +1,171 @@
+#include "lockfreelist.hpp"
+
+#include <climits>
+
+LockFreeSortedList::LNode::LNode(const int key)
+    : key{key},
+      next{0} {
+}
+
+LockFreeSortedList::LockFreeSortedList()
+    : ownedDomain{std::make_unique<EpochDomain>()},
+      domain{ownedDomain.get()},
+      head{new LNode(INT_MIN)},
+      size{0} {
+}
+
+LockFreeSortedList::LockFreeSortedList(EpochDomain& domain)
+    : domain{&domain},
+      head{new LNode(INT_MIN)},
+      size{0} {
+}
+
+LockFreeSortedList::~LockFreeSortedList() {
+    // everything still linked, marked or not, is ours; unlinked nodes were
+    // retired and belong to the domain now
+    LNode* node = head;
+    while (node != nullptr) {
+        LNode* next = pointerOf(node->next.load(std::memory_order_relaxed));
+        delete node;
+        node = next;
+    }
+}
+
+// Marked links
+
+bool LockFreeSortedList::isMarked(const std::uintptr_t link) {
+    return (link & 1) != 0;
+}
+
+LockFreeSortedList::LNode* LockFreeSortedList::pointerOf(const std::uintptr_t link) {
+    return reinterpret_cast<LNode*>(link & ~std::uintptr_t{1});
+}
+
+std::uintptr_t LockFreeSortedList::linkTo(const LNode* node, const bool marked) {
+    return reinterpret_cast<std::uintptr_t>(node) | (marked ? 1 : 0);
+}
+
+LockFreeSortedList::Window LockFreeSortedList::find(const int key) const {
+    /*
+     * Walks to the first node with key >= `key`, unlinking every marked node
+     * on the way. An unlink CAS fails when the predecessor changed or got
+     * marked itself; the window may then be stale, so start over from the
+     * head. The caller must be pinned.
+     */
+    while (true) {
+        LNode* prev = head;
+        LNode* curr = pointerOf(prev->next.load(std::memory_order_acquire));
+        bool restart = false;
+        while (curr != nullptr) {
+            const std::uintptr_t succ = curr->next.load(std::memory_order_acquire);
+            if (isMarked(succ)) {
+                std::uintptr_t expected = linkTo(curr);
+                if (!prev->next.compare_exchange_strong(expected, linkTo(pointerOf(succ)),
+                                                        std::memory_order_acq_rel,
+                                                        std::memory_order_acquire)) {
+                    restart = true;
+                    break;
+                }
+                domain->retire(curr); // our CAS unlinked it, so we retire it
+                curr = pointerOf(succ);
+                continue;
+            }
+            if (curr->key >= key)
+                return {prev, curr};
+            prev = curr;
+            curr = pointerOf(succ);
+        }
+        if (!restart)
+            return {prev, nullptr};
+    }
+}
+
+// Set APIs
+
+bool LockFreeSortedList::insert(const int key) {
+    const EpochDomain::Guard guard(*domain);
+    LNode* node = nullptr;
+    while (true) {
+        const Window window = find(key);
+        if (window.curr != nullptr && window.curr->key == key) {
+            delete node; // never published
+            return false;
+        }
+        if (node == nullptr) {
+            node = new LNode(key);
+        }
+        node->next.store(linkTo(window.curr), std::memory_order_relaxed);
+
+        std::uintptr_t expected = linkTo(window.curr);
+        if (window.prev->next.compare_exchange_strong(expected, linkTo(node),
+                                                      std::memory_order_release,
+                                                      std::memory_order_relaxed)) {
+            size.fetch_add(1, std::memory_order_relaxed);
+            return true;
+        }
+    }
+}
+
+bool LockFreeSortedList::remove(const int key) {
+    const EpochDomain::Guard guard(*domain);
+    while (true) {
+        const Window window = find(key);
+        if (window.curr == nullptr || window.curr->key != key)
+            return false;
+
+        // logical deletion: whoever sets the mark owns the removal
+        std::uintptr_t succ = window.curr->next.load(std::memory_order_acquire);
+        if (isMarked(succ))
+            continue; // another remover got there first; find() will unlink it
+        if (!window.curr->next.compare_exchange_strong(succ, succ | 1,
+                                                       std::memory_order_acq_rel,
+                                                       std::memory_order_relaxed))
+            continue; // an insert behind it or a concurrent remove: retry
+        size.fetch_sub(1, std::memory_order_relaxed);
+
+        // physical deletion; on failure a find() helps instead
+        std::uintptr_t expected = linkTo(window.curr);
+        if (window.prev->next.compare_exchange_strong(expected, succ,
+                                                      std::memory_order_acq_rel,
+                                                      std::memory_order_relaxed)) {
+            domain->retire(window.curr);
+        } else {
+            find(key);
+        }
+        return true;
+    }
+}
+
+bool LockFreeSortedList::contains(const int key) const {
+    const EpochDomain::Guard guard(*domain);
+    const LNode* curr = pointerOf(head->next.load(std::memory_order_acquire));
+    while (curr != nullptr && curr->key < key) {
+        curr = pointerOf(curr->next.load(std::memory_order_acquire));
+    }
+    return curr != nullptr && curr->key == key &&
+        !isMarked(curr->next.load(std::memory_order_acquire));
+}
+
+// Accessors
+
+int LockFreeSortedList::getSize() const {
+    return size.load(std::memory_order_relaxed);
+}
+
+std::vector<int> LockFreeSortedList::toVector() const {
+    const EpochDomain::Guard guard(*domain);
+    std::vector<int> keys;
+    const LNode* curr = pointerOf(head->next.load(std::memory_order_acquire));
+    while (curr != nullptr) {
+        const std::uintptr_t succ = curr->next.load(std::memory_order_acquire);
+        if (!isMarked(succ)) {
+            keys.push_back(curr->key);
+        }
+        curr = pointerOf(succ);
+    }
+    return keys;
+}
+
+EpochDomain& LockFreeSortedList::getDomain() const {
+    return *domain;
+}
@@ -0,0 +1,73 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "epoch.hpp"
+
+/*
+ * Lock-free sorted set of ints (Harris's list with Michael's refinements).
+ *
+ * Removal happens in two steps. First the victim is logically deleted by
+ * setting a mark bit in its own `next` pointer, which also freezes that link
+ * so no insert can slip in behind it. Then it is physically unlinked with a
+ * CAS on its predecessor. Any operation that walks past a marked node helps
+ * unlink it, so a stalled remover never blocks anyone.
+ *
+ *   contains  wait-free: a plain walk, no CAS, no helping
+ *   insert    lock-free: one CAS on the predecessor's link
+ *   remove    lock-free: mark, then unlink (or leave it to a helper)
+ *
+ * Unlinked nodes are handed to an EpochDomain and freed only once no reader
+ * can still be standing on them. The list either owns a private domain or
+ * shares one with other structures.
+ */
+class LockFreeSortedList {
+public:
+    LockFreeSortedList(); // with its own EpochDomain
+    explicit LockFreeSortedList(EpochDomain& domain); // domain must outlive the list
+    ~LockFreeSortedList(); // no other thread may be using the list
+
+    LockFreeSortedList(const LockFreeSortedList&) = delete;
+    LockFreeSortedList& operator=(const LockFreeSortedList&) = delete;
+
+    // 🚀 Set APIs, safe to call from any number of threads
+    bool insert(int key); // false if already present
+    bool remove(int key); // false if absent
+    bool contains(int key) const;
+
+    // 👀 Accessors
+    int getSize() const; // exact when no operation is in flight
+    // Keys in order; only meaningful while no thread is modifying the list
+    std::vector<int> toVector() const;
+    EpochDomain& getDomain() const;
+
+private:
+    struct LNode {
+        explicit LNode(int key);
+
+        const int key;
+        // successor, with bit 0 set once this node is logically deleted
+        std::atomic<std::uintptr_t> next;
+    };
+
+    // prev->next == curr (unmarked) and curr is the first node with key >= key
+    struct Window {
+        LNode* prev;
+        LNode* curr;
+    };
+
+    static bool isMarked(std::uintptr_t link);
+    static LNode* pointerOf(std::uintptr_t link);
+    static std::uintptr_t linkTo(const LNode* node, bool marked = false);
+
+    Window find(int key) const;
+
+    std::unique_ptr<EpochDomain> ownedDomain;
+    EpochDomain* domain;
+    LNode* head; // sentinel; its key is never compared
+    std::atomic<int> size;
+};
@@ -0,0 +1,253 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <utility>
+#include <vector>
+
+#include "intrusivelist.hpp"
+
+/*
+ * Fixed-capacity least-recently-used cache.
+ *
+ * Two structures work together:
+ * - a recency list (most recent at the head, least recent at the tail), and
+ * - an open-addressing hash index from key to the entry holding it.
+ *
+ * Entries live in one vector that is sized once in the constructor. The
+ * recency list is an IntrusiveList whose hook is embedded in each entry, so
+ * get/put/evict relink entries in O(1) and never allocate after construction.
+ *
+ * The index uses linear probing and backward-shift deletion, so there are no
+ * tombstones and lookups never degrade after many evictions.
+ */
+template <typename K, typename V, typename Hash = std::hash<K>>
+class LRUCache {
+public:
+    explicit LRUCache(std::size_t capacity)
+        : maxEntries{capacity} {
+        entries.reserve(capacity);
+
+        // keep the index at most half full so probe sequences stay short
+        std::size_t tableSize = 2;
+        while (tableSize < capacity * 2) {
+            tableSize *= 2;
+        }
+        table.assign(tableSize, kEmpty);
+        mask = tableSize - 1;
+    }
+
+    // the recency list points into `entries`, so the cache is not copyable
+    LRUCache(const LRUCache&) = delete;
+    LRUCache& operator=(const LRUCache&) = delete;
+
+    // 🚀 LRUCache APIs
+
+    /*
+     * Looks up a key and marks it as most recently used.
+     *
+     * Returns:
+     * - a pointer to the cached value on a hit (valid until the entry is
+     *   evicted or erased), or nullptr on a miss.
+     */
+    V* get(const K& key) {
+        const std::size_t slot = findSlot(key);
+        if (table[slot] == kEmpty) {
+            ++misses;
+            return nullptr;
+        }
+
+        ++hits;
+        Entry& entry = entries[table[slot]];
+        recency.moveToFront(entry);
+        return &entry.value;
+    }
+
+    // Looks up a key without touching recency order or hit/miss counters
+    const V* peek(const K& key) const {
+        const std::size_t slot = findSlot(key);
+        if (table[slot] == kEmpty)
+            return nullptr;
+        return &entries[table[slot]].value;
+    }
+
+    bool contains(const K& key) const {
+        return table[findSlot(key)] != kEmpty;
+    }
+
+    /*
+     * Inserts or updates a key and marks it as most recently used.
+     * If the cache is full, the least recently used entry is evicted first.
+     */
+    void put(const K& key, V value) {
+        if (maxEntries == 0)
+            return;
+
+        std::size_t slot = findSlot(key);
+        if (table[slot] != kEmpty) {
+            // update in place
+            Entry& entry = entries[table[slot]];
+            entry.value = std::move(value);
+            recency.moveToFront(entry);
+            return;
+        }
+
+        if (static_cast<std::size_t>(recency.getLength()) == maxEntries) {
+            evict();
+            // eviction may have shifted entries inside the probe sequence
+            slot = findSlot(key);
+        }
+
+        const std::int32_t index = acquireEntry(key, std::move(value));
+        table[slot] = index;
+        recency.prepend(entries[index]);
+    }
+
+    // Removes a key; returns false if it was not cached
+    bool erase(const K& key) {
+        const std::size_t slot = findSlot(key);
+        if (table[slot] == kEmpty)
+            return false;
+
+        const std::int32_t index = table[slot];
+        removeFromIndex(slot);
+        recency.erase(entries[index]);
+        freeEntries.push_back(index);
+        return true;
+    }
+
+    // Evicts the least recently used entry; returns false if empty
+    bool evict() {
+        Entry* victim = recency.getTail();
+        if (victim == nullptr)
+            return false;
+
+        removeFromIndex(findSlot(victim->key));
+        recency.erase(*victim);
+        freeEntries.push_back(static_cast<std::int32_t>(victim - entries.data()));
+        ++evictions;
+        return true;
+    }
+
+    void clear() {
+        recency.clear();
+        entries.clear();
+        freeEntries.clear();
+        table.assign(table.size(), kEmpty);
+    }
+
+    // Key of the least recently used entry, or nullptr if empty
+    const K* leastRecentKey() const {
+        const Entry* entry = recency.getTail();
+        return entry ? &entry->key : nullptr;
+    }
+
+    const K* mostRecentKey() const {
+        const Entry* entry = recency.getHead();
+        return entry ? &entry->key : nullptr;
+    }
+
+    // 👀 Accessors
+    std::size_t getSize() const {
+        return static_cast<std::size_t>(recency.getLength());
+    }
+
+    std::size_t getCapacity() const {
+        return maxEntries;
+    }
+
+    std::uint64_t getHits() const {
+        return hits;
+    }
+
+    std::uint64_t getMisses() const {
+        return misses;
+    }
+
+    std::uint64_t getEvictions() const {
+        return evictions;
+    }
+
+    void resetStats() {
+        hits = misses = evictions = 0;
+    }
+
+private:
+    struct Entry : ListHook<> {
+        K key;
+        V value;
+
+        Entry(const K& key, V value)
+            : key{key},
+              value{std::move(value)} {
+        }
+    };
+
+    static constexpr std::int32_t kEmpty = -1;
+
+    std::size_t homeSlot(const K& key) const {
+        // std::hash<int> is the identity on common standard libraries; mix the
+        // bits (Fibonacci hashing) so sequential keys do not form long runs
+        const std::uint64_t h = static_cast<std::uint64_t>(hasher(key));
+        return static_cast<std::size_t>((h * 0x9E3779B97F4A7C15ULL) >> 32) &
+            mask;
+    }
+
+    // Returns the slot holding `key`, or the empty slot where it would go
+    std::size_t findSlot(const K& key) const {
+        std::size_t slot = homeSlot(key);
+        while (table[slot] != kEmpty && !(entries[table[slot]].key == key)) {
+            slot = (slot + 1) & mask;
+        }
+        return slot;
+    }
+
+    /*
+     * Backward-shift deletion: after emptying a slot, walk the rest of the
+     * probe cluster and pull back any entry whose home slot is at or before
+     * the hole, so every remaining key is still reachable from its home slot.
+     */
+    void removeFromIndex(std::size_t hole) {
+        table[hole] = kEmpty;
+        std::size_t slot = (hole + 1) & mask;
+
+        while (table[slot] != kEmpty) {
+            const std::size_t home = homeSlot(entries[table[slot]].key);
+            // distance from home to current slot vs. from home to the hole
+            const std::size_t toSlot = (slot - home) & mask;
+            const std::size_t toHole = (hole - home) & mask;
+            if (toHole < toSlot) {
+                table[hole] = table[slot];
+                table[slot] = kEmpty;
+                hole = slot;
+            }
+            slot = (slot + 1) & mask;
+        }
+    }
+
+    std::int32_t acquireEntry(const K& key, V value) {
+        if (!freeEntries.empty()) {
+            const std::int32_t index = freeEntries.back();
+            freeEntries.pop_back();
+            entries[index].key = key;
+            entries[index].value = std::move(value);
+            return index;
+        }
+        // never exceeds the reserved capacity, so entries are never moved
+        entries.emplace_back(key, std::move(value));
+        return static_cast<std::int32_t>(entries.size() - 1);
+    }
+
+    std::size_t maxEntries;
+    std::vector<Entry> entries;
+    std::vector<std::int32_t> freeEntries;
+    std::vector<std::int32_t> table;
+    std::size_t mask = 0;
+    IntrusiveList<Entry> recency;
+    Hash hasher{};
+
+    std::uint64_t hits = 0;
+    std::uint64_t misses = 0;
+    std::uint64_t evictions = 0;
+};
@@ -0,0 +1,94 @@
+#include "nodechunkresource.hpp"
+
+#include <algorithm>
+
+NodeChunkResource::NodeChunkResource(
+    const std::size_t blockSize,
+    const std::size_t blocksPerChunk,
+    std::pmr::memory_resource* upstream)
+    // a block must be able to hold the free-list link, and stays
+    // max_align_t-aligned when blocks are packed back to back
+    : blockSize{(std::max(blockSize, sizeof(FreeBlock)) + alignof(std::max_align_t) - 1) /
+                alignof(std::max_align_t) * alignof(std::max_align_t)},
+      blocksPerChunk{std::max<std::size_t>(blocksPerChunk, 1)},
+      upstream{upstream},
+      cursor{nullptr},
+      chunkEnd{nullptr},
+      freeList{nullptr},
+      blocksInUse{0} {
+}
+
+NodeChunkResource::~NodeChunkResource() {
+    release();
+}
+
+void NodeChunkResource::release() {
+    for (std::byte* chunk : chunks) {
+        upstream->deallocate(chunk, blockSize * blocksPerChunk, kCacheLine);
+    }
+    chunks.clear();
+    cursor = chunkEnd = nullptr;
+    freeList = nullptr;
+    blocksInUse = 0;
+}
+
+bool NodeChunkResource::fitsBlock(const std::size_t bytes, const std::size_t alignment) const {
+    return bytes <= blockSize && alignment <= alignof(std::max_align_t);
+}
+
+void NodeChunkResource::addChunk() {
+    const std::size_t bytes = blockSize * blocksPerChunk;
+    auto* chunk = static_cast<std::byte*>(upstream->allocate(bytes, kCacheLine));
+    chunks.push_back(chunk);
+    cursor = chunk;
+    chunkEnd = chunk + bytes;
+}
+
+void* NodeChunkResource::do_allocate(const std::size_t bytes, const std::size_t alignment) {
+    if (!fitsBlock(bytes, alignment))
+        return upstream->allocate(bytes, alignment);
+
+    ++blocksInUse;
+    if (freeList) {
+        FreeBlock* block = freeList;
+        freeList = block->next;
+        return block;
+    }
+    // bump allocation keeps blocks in the order they were asked for
+    if (cursor == chunkEnd) {
+        addChunk();
+    }
+    void* block = cursor;
+    cursor += blockSize;
+    return block;
+}
+
+void NodeChunkResource::do_deallocate(
+    void* p,
+    const std::size_t bytes,
+    const std::size_t alignment) {
+    if (!fitsBlock(bytes, alignment)) {
+        upstream->deallocate(p, bytes, alignment);
+        return;
+    }
+    auto* block = static_cast<FreeBlock*>(p);
+    block->next = freeList;
+    freeList = block;
+    --blocksInUse;
+}
+
+bool NodeChunkResource::do_is_equal(const std::pmr::memory_resource& other) const noexcept {
+    return this == &other;
+}
+
+std::size_t NodeChunkResource::getBlockSize() const {
+    return blockSize;
+}
+
+std::size_t NodeChunkResource::getChunkCount() const {
+    return chunks.size();
+}
+
+std::size_t NodeChunkResource::getBlocksInUse() const {
+    return blocksInUse;
+}
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <cstddef>
+#include <memory_resource>
+#include <vector>
+
+/*
+ * std::pmr resource that hands out fixed-size node blocks from large
+ * contiguous chunks, in allocation order.
+ *
+ * A list built by append() on this resource has its nodes laid out in
+ * traversal order: consecutive nodes share cache lines (four 16-byte Nodes
+ * per 64-byte line) and the hardware prefetcher sees a sequential stream, so
+ * walking the list costs a fraction of the misses of malloc-scattered nodes.
+ *
+ * Chunks are cache-line aligned and are only returned to the upstream
+ * resource by release() or the destructor. Freed blocks go on a free list and
+ * are reused first. Requests larger than the block size (or over-aligned)
+ * pass straight through to upstream.
+ */
+class NodeChunkResource : public std::pmr::memory_resource {
+public:
+    static constexpr std::size_t kCacheLine = 64;
+
+    explicit NodeChunkResource(
+        std::size_t blockSize,
+        std::size_t blocksPerChunk = 4096,
+        std::pmr::memory_resource* upstream = std::pmr::get_default_resource());
+    ~NodeChunkResource() override;
+
+    NodeChunkResource(const NodeChunkResource&) = delete;
+    NodeChunkResource& operator=(const NodeChunkResource&) = delete;
+
+    // Returns every chunk upstream; all outstanding blocks become invalid
+    void release();
+
+    // 👀 Accessors
+    std::size_t getBlockSize() const;
+    std::size_t getChunkCount() const;
+    std::size_t getBlocksInUse() const;
+
+private:
+    void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+    void do_deallocate(void* p, std::size_t bytes, std::size_t alignment) override;
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+
+    bool fitsBlock(std::size_t bytes, std::size_t alignment) const;
+    void addChunk();
+
+    struct FreeBlock {
+        FreeBlock* next;
+    };
+
+    std::size_t blockSize;
+    std::size_t blocksPerChunk;
+    std::pmr::memory_resource* upstream;
+    std::vector<std::byte*> chunks;
+    std::byte* cursor; // next never-used block in the newest chunk
+    std::byte* chunkEnd;
+    FreeBlock* freeList;
+    std::size_t blocksInUse;
+};
@@ -0,0 +1,191 @@
+#include "persistentlist.hpp"
+
+#include <climits>
+#include <iterator>
+#include <utility>
+
+// Node
+
+PersistentList::PNode::PNode(const int value, PNode* next)
+    : value{value},
+      next{next} {
+}
+
+// Iterator
+
+PersistentList::ConstIterator::ConstIterator(const PNode* node)
+    : node{node} {
+}
+
+PersistentList::ConstIterator::reference PersistentList::ConstIterator::operator*() const {
+    return node->value;
+}
+
+PersistentList::ConstIterator& PersistentList::ConstIterator::operator++() {
+    node = node->next;
+    return *this;
+}
+
+PersistentList::ConstIterator PersistentList::ConstIterator::operator++(int) {
+    ConstIterator previous = *this;
+    node = node->next;
+    return previous;
+}
+
+// Construction and destruction
+
+PersistentList::PersistentList()
+    : head{nullptr},
+      length{0} {
+}
+
+PersistentList::PersistentList(const std::initializer_list<int> values)
+    : head{nullptr},
+      length{0} {
+    // build back to front so each node is created with its final successor
+    for (auto it = std::rbegin(values); it != std::rend(values); ++it) {
+        head = new PNode(*it, head);
+        ++length;
+    }
+}
+
+PersistentList::PersistentList(PNode* head, const int length)
+    : head{head},
+      length{length} {
+}
+
+PersistentList::~PersistentList() {
+    release(head);
+}
+
+PersistentList::PersistentList(const PersistentList& other)
+    : head{retain(other.head)},
+      length{other.length} {
+}
+
+PersistentList& PersistentList::operator=(const PersistentList& other) {
+    if (this != &other) {
+        PNode* old = std::exchange(head, retain(other.head));
+        length = other.length;
+        release(old);
+    }
+    return *this;
+}
+
+PersistentList::PersistentList(PersistentList&& other) noexcept
+    : head{std::exchange(other.head, nullptr)},
+      length{std::exchange(other.length, 0)} {
+}
+
+PersistentList& PersistentList::operator=(PersistentList&& other) noexcept {
+    if (this != &other) {
+        PNode* old = std::exchange(head, std::exchange(other.head, nullptr));
+        length = std::exchange(other.length, 0);
+        release(old);
+    }
+    return *this;
+}
+
+PersistentList::PNode* PersistentList::retain(PNode* node) {
+    // a new reference is copied from one we already hold, so there is
+    // nothing to order: the node cannot be freed under us
+    if (node)
+        node->refs.fetch_add(1, std::memory_order_relaxed);
+    return node;
+}
+
+void PersistentList::release(PNode* node) {
+    /*
+     * With shared_ptr links, freeing a node frees its `next`, whose destructor
+     * frees its `next`, and so on: one stack frame per uniquely owned node.
+     * Instead, drop our reference and, only if it was the last one, free the
+     * node and carry its reference to the successor along to drop next. A node
+     * still referenced elsewhere just loses our reference and stops the walk.
+     *
+     * Exactly one of several threads dropping the same node concurrently sees
+     * the count go 1 -> 0 (a use_count() check can have two of them see 2 and
+     * both stop). acq_rel makes that thread's read of `next` and the delete
+     * happen after every other owner's earlier accesses to the node.
+     */
+    while (node && node->refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        PNode* next = node->next;
+        delete node;
+        node = next;
+    }
+}
+
+// PersistentList APIs
+
+PersistentList PersistentList::prepend(const int value) const {
+    return {new PNode(value, retain(head)), length + 1};
+}
+
+PersistentList PersistentList::popFront() const {
+    if (!head)
+        return {};
+    return {retain(head->next), length - 1};
+}
+
+PersistentList PersistentList::reversed() const {
+    PNode* result = nullptr;
+    for (const PNode* node = head; node; node = node->next) {
+        result = new PNode(node->value, result);
+    }
+    return {result, length};
+}
+
+PersistentList PersistentList::snapshot() const {
+    return *this;
+}
+
+int PersistentList::front() const {
+    return head ? head->value : INT_MIN;
+}
+
+int PersistentList::get(const int index) const {
+    if (index < 0 || index >= length)
+        return INT_MIN;
+    const PNode* node = head;
+    for (int i = 0; i < index; ++i) {
+        node = node->next;
+    }
+    return node->value;
+}
+
+// Accessors
+
+int PersistentList::getLength() const {
+    return length;
+}
+
+bool PersistentList::isEmpty() const {
+    return length == 0;
+}
+
+bool PersistentList::sharesNodesWith(const PersistentList& other) const {
+    return head != nullptr && head == other.head;
+}
+
+long PersistentList::getHeadUseCount() const {
+    return head ? head->refs.load(std::memory_order_relaxed) : 0;
+}
+
+PersistentList::ConstIterator PersistentList::begin() const {
+    return ConstIterator(head);
+}
+
+PersistentList::ConstIterator PersistentList::end() const {
+    return ConstIterator(nullptr);
+}
+
+std::ostream& operator<<(std::ostream& stream, const PersistentList& list) {
+    stream << "{";
+    bool first = true;
+    for (const int value : list) {
+        if (!first)
+            stream << ", ";
+        stream << value;
+        first = false;
+    }
+    return stream << "}";
+}
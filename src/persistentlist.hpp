@@ -0,0 +1,103 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <ostream>
+
+/*
+ * Persistent (immutable) singly linked list with structural sharing.
+ *
+ * Nodes never change after construction and every node holds a counted
+ * reference to the rest of the list. "Modifying" operations return a new list that shares
+ * all the nodes it did not have to change with its source:
+ *
+ *   prepend, popFront, copy (= snapshot)   O(1), no node copied
+ *   get, reversed, construction from ints  O(n)
+ *
+ * A snapshot is therefore one reference-count increment instead of the O(n)
+ * deep copy LinkedList's copy constructor does, and since nodes are immutable
+ * any number of threads may read and drop snapshots concurrently (the counts
+ * are atomic and intrusive). Nodes are freed when the last list referencing
+ * them goes away; that release is iterative, so dropping a million-node list
+ * does not recurse a million frames deep.
+ */
+class PersistentList {
+    struct PNode;
+
+public:
+    class ConstIterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = int;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const int*;
+        using reference = const int&;
+
+        ConstIterator() = default;
+        explicit ConstIterator(const PNode* node);
+
+        reference operator*() const;
+        ConstIterator& operator++();
+        ConstIterator operator++(int);
+        bool operator==(const ConstIterator& other) const = default;
+
+    private:
+        const PNode* node = nullptr;
+    };
+
+    PersistentList(); // empty list
+    PersistentList(std::initializer_list<int> values);
+    ~PersistentList();
+
+    PersistentList(const PersistentList& other); // O(1) snapshot
+    PersistentList& operator=(const PersistentList& other);
+    PersistentList(PersistentList&& other) noexcept;
+    PersistentList& operator=(PersistentList&& other) noexcept;
+
+    // 🚀 PersistentList APIs (the list itself is never modified)
+    PersistentList prepend(int value) const;
+    PersistentList popFront() const; // empty stays empty
+    PersistentList reversed() const;
+    PersistentList snapshot() const; // same as a copy; spelled out for call sites
+
+    int front() const; // uses INT_MIN as sentinel value
+    int get(int index) const; // uses INT_MIN as sentinel value
+
+    // 👀 Accessors
+    int getLength() const;
+    bool isEmpty() const;
+    // Both lists reference the very same first node
+    bool sharesNodesWith(const PersistentList& other) const;
+    // Lists (and longer lists) currently referencing the first node
+    long getHeadUseCount() const;
+
+    ConstIterator begin() const;
+    ConstIterator end() const;
+
+private:
+    // Never modified once built. `refs` counts the lists and nodes pointing
+    // here; a new node starts with the one reference its creator holds
+    struct PNode {
+        PNode(int value, PNode* next);
+
+        int value;
+        PNode* next; // owns one reference to the successor
+        std::atomic<long> refs{1};
+    };
+
+    // Takes over the caller's reference to `head`
+    PersistentList(PNode* head, int length);
+
+    // Adds one reference to `node` (may be nullptr) and returns it
+    static PNode* retain(PNode* node);
+    // Drops one reference to `node` and, iteratively, to every node that
+    // becomes unreferenced as a result
+    static void release(PNode* node);
+
+    PNode* head;
+    int length;
+};
+
+std::ostream& operator<<(std::ostream& stream, const PersistentList& list);
@@ -0,0 +1,163 @@
+#include "pipeline.hpp"
+
+#include <algorithm>
+#include <utility>
+
+namespace {
+long long nanosSince(const std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now() - start)
+        .count();
+}
+} // namespace
+
+Pipeline::Stage::Stage(const std::string& name, StageFunction function, const int threads)
+    : name{name},
+      function{std::move(function)},
+      threads{threads},
+      running{0},
+      batches{0},
+      valuesIn{0},
+      valuesOut{0},
+      busyNanos{0},
+      blockedNanos{0},
+      maxQueueDepth{0} {
+}
+
+Pipeline::Pipeline(const int queueCapacity, const int batchSize)
+    : queueCapacity{std::max(queueCapacity, 1)},
+      batchSize{std::max(batchSize, 1)},
+      started{false} {
+    queues.push_back(std::make_unique<BlockingQueue>(this->queueCapacity));
+}
+
+Pipeline::~Pipeline() {
+    // closing every queue makes each blocked push or pop return
+    for (const auto& queue : queues) {
+        queue->close();
+    }
+    wait();
+}
+
+// Setup
+
+bool Pipeline::addStage(const std::string& name, StageFunction function, const int threads) {
+    if (started || !function || threads < 1)
+        return false;
+    stages.push_back(std::make_unique<Stage>(name, std::move(function), threads));
+    queues.push_back(std::make_unique<BlockingQueue>(queueCapacity));
+    return true;
+}
+
+void Pipeline::start() {
+    if (started)
+        return;
+    started = true;
+    startTime = Clock::now();
+    if (stages.empty()) {
+        queues.back()->close(); // nothing will ever come out
+        return;
+    }
+    for (int i = 0; i < static_cast<int>(stages.size()); ++i) {
+        stages[i]->running.store(stages[i]->threads);
+        for (int t = 0; t < stages[i]->threads; ++t) {
+            workers.emplace_back(&Pipeline::runStage, this, i);
+        }
+    }
+}
+
+void Pipeline::runStage(const int index) {
+    Stage& stage = *stages[index];
+    BlockingQueue& input = *queues[index];
+    BlockingQueue& output = *queues[index + 1];
+    Batch in;
+    Batch out;
+    in.reserve(static_cast<std::size_t>(batchSize));
+
+    while (true) {
+        const int depth = input.getSize();
+        int seen = stage.maxQueueDepth.load(std::memory_order_relaxed);
+        while (depth > seen && !stage.maxQueueDepth.compare_exchange_weak(seen, depth)) {
+        }
+
+        in.clear();
+        if (input.popBatch(in, batchSize) == 0)
+            break; // closed and drained
+
+        out.clear();
+        const auto busyStart = Clock::now();
+        stage.function(in, out);
+        stage.busyNanos.fetch_add(nanosSince(busyStart), std::memory_order_relaxed);
+        stage.batches.fetch_add(1, std::memory_order_relaxed);
+        stage.valuesIn.fetch_add(static_cast<long long>(in.size()), std::memory_order_relaxed);
+        stage.valuesOut.fetch_add(static_cast<long long>(out.size()), std::memory_order_relaxed);
+
+        if (!out.empty()) {
+            const auto blockedStart = Clock::now();
+            const int pushed = output.pushBatch(out);
+            stage.blockedNanos.fetch_add(nanosSince(blockedStart), std::memory_order_relaxed);
+            if (pushed < static_cast<int>(out.size()))
+                break; // torn down from the destructor
+        }
+    }
+    // the last thread out tells the next stage no more is coming
+    if (stage.running.fetch_sub(1) == 1)
+        output.close();
+}
+
+// Streaming APIs
+
+bool Pipeline::push(const int value) {
+    return queues.front()->push(value);
+}
+
+int Pipeline::pushBatch(const Batch& values) {
+    return queues.front()->pushBatch(values);
+}
+
+void Pipeline::close() {
+    queues.front()->close();
+}
+
+int Pipeline::popBatch(Batch& out, const int maxCount) {
+    return queues.back()->popBatch(out, maxCount);
+}
+
+void Pipeline::wait() {
+    for (std::thread& worker : workers) {
+        if (worker.joinable())
+            worker.join();
+    }
+}
+
+// Accessors
+
+std::vector<Pipeline::StageMetrics> Pipeline::getMetrics() const {
+    const double elapsed = started ? std::chrono::duration<double>(Clock::now() - startTime).count() : 0.0;
+    std::vector<StageMetrics> metrics;
+    for (std::size_t i = 0; i < stages.size(); ++i) {
+        const Stage& stage = *stages[i];
+        StageMetrics entry{};
+        entry.name = stage.name;
+        entry.threads = stage.threads;
+        entry.batches = stage.batches.load(std::memory_order_relaxed);
+        entry.valuesIn = stage.valuesIn.load(std::memory_order_relaxed);
+        entry.valuesOut = stage.valuesOut.load(std::memory_order_relaxed);
+        entry.busySeconds = static_cast<double>(stage.busyNanos.load(std::memory_order_relaxed)) / 1e9;
+        entry.blockedSeconds =
+            static_cast<double>(stage.blockedNanos.load(std::memory_order_relaxed)) / 1e9;
+        entry.valuesPerSecond = elapsed > 0.0 ? static_cast<double>(entry.valuesIn) / elapsed : 0.0;
+        entry.queueDepth = queues[i]->getSize();
+        entry.maxQueueDepth = stage.maxQueueDepth.load(std::memory_order_relaxed);
+        metrics.push_back(entry);
+    }
+    return metrics;
+}
+
+int Pipeline::getStageCount() const {
+    return static_cast<int>(stages.size());
+}
+
+bool Pipeline::isStarted() const {
+    return started;
+}
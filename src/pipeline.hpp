@@ -0,0 +1,109 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "blockingqueue.hpp"
+
+/*
+ * Chain of processing stages, each on its own thread(s), connected by
+ * bounded BlockingQueues:
+ *
+ *     Pipeline pipeline(1024, 64);
+ *     pipeline.addStage("double", [](const Pipeline::Batch& in, Pipeline::Batch& out) {
+ *         for (const int value : in)
+ *             out.push_back(2 * value);
+ *     });
+ *     pipeline.start();
+ *     pipeline.pushBatch(values);
+ *     pipeline.close();
+ *     while (pipeline.popBatch(results, 64) > 0) { ... }
+ *     pipeline.wait();
+ *
+ * Values move in batches of up to batchSize: a stage takes a batch with one
+ * lock, transforms it, and hands the result on with one lock. Queues are
+ * bounded, so a slow stage fills its input queue and blocks the stage in
+ * front of it (backpressure) instead of buffering without limit.
+ *
+ * A stage function may keep state (a parser's partial token, a running sum)
+ * as long as the stage has one thread; with several threads it is called
+ * concurrently and batch order between them is not kept. Closing the input
+ * shuts the stages down in order once they have drained. The output of the
+ * last stage is read with popBatch(); a last stage that emits nothing (a
+ * reduction) needs no reader.
+ */
+class Pipeline {
+public:
+    using Batch = std::vector<int>;
+    // Reads one input batch and appends any results to `out` (empty on entry)
+    using StageFunction = std::function<void(const Batch& in, Batch& out)>;
+
+    struct StageMetrics {
+        std::string name;
+        int threads;
+        long long batches; // input batches processed
+        long long valuesIn;
+        long long valuesOut;
+        double busySeconds; // inside the stage function, summed over threads
+        double blockedSeconds; // waiting for room downstream (backpressure)
+        double valuesPerSecond; // valuesIn over wall time since start()
+        int queueDepth; // values waiting in the stage's input queue now
+        int maxQueueDepth; // deepest input queue the stage has seen
+    };
+
+    Pipeline(int queueCapacity, int batchSize);
+    ~Pipeline(); // closes every queue and joins; unread output is dropped
+
+    Pipeline(const Pipeline&) = delete;
+    Pipeline& operator=(const Pipeline&) = delete;
+
+    // 🏗️ Setup: only before start()
+    bool addStage(const std::string& name, StageFunction function, int threads = 1);
+    void start();
+
+    // 🚀 Streaming APIs
+    bool push(int value); // blocks while the first queue is full
+    int pushBatch(const Batch& values);
+    void close(); // no more input; stages finish what they have
+    int popBatch(Batch& out, int maxCount); // 0 once the last stage is done
+    void wait(); // joins every stage thread
+
+    // 👀 Accessors, safe while running
+    std::vector<StageMetrics> getMetrics() const;
+    int getStageCount() const;
+    bool isStarted() const;
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    struct Stage {
+        Stage(const std::string& name, StageFunction function, int threads);
+
+        const std::string name;
+        const StageFunction function;
+        const int threads;
+        std::atomic<int> running;
+        std::atomic<long long> batches;
+        std::atomic<long long> valuesIn;
+        std::atomic<long long> valuesOut;
+        std::atomic<long long> busyNanos;
+        std::atomic<long long> blockedNanos;
+        std::atomic<int> maxQueueDepth;
+    };
+
+    void runStage(int index);
+
+    const int queueCapacity;
+    const int batchSize;
+    std::vector<std::unique_ptr<Stage>> stages;
+    // queues[i] feeds stage i; queues.back() holds the final output
+    std::vector<std::unique_ptr<BlockingQueue>> queues;
+    std::vector<std::thread> workers;
+    Clock::time_point startTime;
+    bool started;
+};
@@ -0,0 +1,35 @@
+#pragma once
+
+/*
+ * Software prefetch hint for pointer-chasing loops.
+ *
+ * A list traversal stalls on a cache miss at every `next`. Asking for the
+ * following node as soon as its address is known lets that miss overlap with
+ * the work on the current node. The hint never faults, so passing nullptr (the
+ * end of a list) is fine.
+ *
+ * A pure pointer chase cannot run further ahead than its own dependent loads,
+ * so the gain is limited to loops that do work per node; the big win for long
+ * lists is laying nodes out contiguously (see NodeChunkResource). Build with
+ * -DENABLE_PREFETCH=OFF to compile the hints out and A/B with
+ * bench/traversal_bench.
+ */
+#ifndef DS_PREFETCH_ENABLED
+#define DS_PREFETCH_ENABLED 1
+#endif
+
+inline void prefetchForRead(const void* address) {
+#if DS_PREFETCH_ENABLED && (defined(__GNUC__) || defined(__clang__))
+    __builtin_prefetch(address, 0, 3);
+#else
+    (void)address;
+#endif
+}
+
+inline void prefetchForWrite(const void* address) {
+#if DS_PREFETCH_ENABLED && (defined(__GNUC__) || defined(__clang__))
+    __builtin_prefetch(address, 1, 3);
+#else
+    (void)address;
+#endif
+}
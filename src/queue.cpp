@@ -1,10 +1,39 @@
 #include "queue.hpp"
 #include <climits>
 #include <iostream>
+#include <new>
 
-Queue::Queue(int value) {
-    first = last = new QNode(value);
+Queue::Queue(std::pmr::memory_resource* resource)
+    : size{0},
+      first{nullptr},
+      last{nullptr},
+      resource{resource} {
+}
+
+Queue::Queue(const int value, std::pmr::memory_resource* resource)
+    : resource{resource} {
+    first = last = createNode(value);
     size = 1;
+    stats.recordInsert(size);
+}
+
+// Node allocation: every node the queue owns is created and destroyed here
+QNode* Queue::createNode(const int value) {
+    stats.recordAllocation(sizeof(QNode));
+    if (resource) {
+        return new (resource->allocate(sizeof(QNode), alignof(QNode))) QNode(value);
+    }
+    return new QNode(value);
+}
+
+void Queue::destroyNode(QNode* node) {
+    stats.recordDeallocation(sizeof(QNode));
+    if (resource) {
+        node->~QNode();
+        resource->deallocate(node, sizeof(QNode), alignof(QNode));
+        return;
+    }
+    delete node;
 }
 
 Queue::~Queue() {
@@ -34,7 +63,7 @@ void Queue::clear() {
     QNode* current = first;
     while (current) {
         QNode* next = current->next;
-        delete current;
+        destroyNode(current);
         current = next;
     }
     first = last = nullptr;
@@ -42,7 +71,7 @@ void Queue::clear() {
 }
 
 void Queue::enQueue(int value) {
-    QNode* newNode = new QNode(value);
+    QNode* newNode = createNode(value);
 
     if (size == 0) {
         first = last = newNode;
@@ -51,11 +80,14 @@ void Queue::enQueue(int value) {
         last = newNode;
     }
     ++size;
+    stats.recordInsert(size);
 }
 
 int Queue::deQueue() {
-    if (size == 0)
+    if (size == 0) {
+        stats.recordEmptyRemoval();
         return INT_MIN;
+    }
 
     QNode* temp = first;
     const int dequeuedValue = first->data;
@@ -66,8 +98,9 @@ int Queue::deQueue() {
         first = first->next;
     }
 
-    delete temp;
+    destroyNode(temp);
     --size;
+    stats.recordRemoval();
 
     return dequeuedValue;
 }
@@ -81,4 +114,16 @@ int Queue::peek() const {
         return INT_MIN;
 
     return first->data;
-}
\ No newline at end of file
+}
+
+std::pmr::memory_resource* Queue::getResource() const {
+    return resource;
+}
+
+StatsSnapshot Queue::getStats() const {
+    return stats.snapshot();
+}
+
+void Queue::resetStats() {
+    stats.reset();
+}
@@ -1,5 +1,9 @@
 #pragma once
 
+#include <memory_resource>
+
+#include "containerstats.hpp"
+
 class QNode {
 public:
     QNode* next;
@@ -14,12 +18,23 @@ public:
 
 class Queue {
 private:
+    QNode* createNode(int value);
+    void destroyNode(QNode* node);
+
     int size;
     QNode* first;
     QNode* last;
+    std::pmr::memory_resource* resource;
+    [[no_unique_address]] ContainerStats stats;
 
 public:
-    explicit Queue(int value);
+    /*
+     * Nodes are allocated from `resource` (a pool, monotonic or NUMA-local
+     * std::pmr::memory_resource) when one is given, and with plain new/delete
+     * otherwise. The resource must outlive the queue.
+     */
+    explicit Queue(std::pmr::memory_resource* resource = nullptr); // empty queue
+    explicit Queue(int value, std::pmr::memory_resource* resource = nullptr);
     ~Queue();
 
     void enQueue(int value);
@@ -28,4 +43,11 @@ public:
     int peek() const; // uses INT_MIN as sentinel value
     void display() const;
     void clear();
+
+    // nullptr when nodes come from the global heap
+    std::pmr::memory_resource* getResource() const;
+
+    // 📊 Usage counters (all zero unless built with ENABLE_CONTAINER_STATS)
+    StatsSnapshot getStats() const;
+    void resetStats();
 };
\ No newline at end of file
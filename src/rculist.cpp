@@ -0,0 +1,174 @@
+#include "rculist.hpp"
+
+#include <climits>
+
+RcuList::RNode::RNode(const int value, const RNode* next)
+    : value{value},
+      next{next} {
+}
+
+RcuList::RcuList()
+    : ownedDomain{std::make_unique<EpochDomain>(EpochDomain::PinMode::Asymmetric)},
+      domain{ownedDomain.get()},
+      head{nullptr},
+      length{0} {
+}
+
+RcuList::RcuList(EpochDomain& domain)
+    : domain{&domain},
+      head{nullptr},
+      length{0} {
+}
+
+RcuList::~RcuList() {
+    const RNode* node = head.load(std::memory_order_relaxed);
+    while (node != nullptr) {
+        const RNode* next = node->next;
+        delete node;
+        node = next;
+    }
+}
+
+// Readers
+
+bool RcuList::contains(const int value) const {
+    const EpochDomain::Guard guard(*domain);
+    for (const RNode* node = head.load(std::memory_order_acquire); node; node = node->next) {
+        if (node->value == value)
+            return true;
+    }
+    return false;
+}
+
+int RcuList::get(const int index) const {
+    if (index < 0)
+        return INT_MIN;
+    const EpochDomain::Guard guard(*domain);
+    const RNode* node = nodeAt(index);
+    return node ? node->value : INT_MIN;
+}
+
+std::vector<int> RcuList::toVector() const {
+    std::vector<int> values;
+    forEach([&values](const int value) { values.push_back(value); });
+    return values;
+}
+
+// Writers
+
+const RcuList::RNode* RcuList::nodeAt(const int index) const {
+    const RNode* node = head.load(std::memory_order_acquire);
+    for (int i = 0; node != nullptr && i < index; ++i) {
+        node = node->next;
+    }
+    return node;
+}
+
+void RcuList::retire(const RNode* node) {
+    domain->retire(const_cast<RNode*>(node));
+}
+
+void RcuList::rebuild(const int count, const RNode* tail, const RNode* alsoRetired,
+                      const int newLength) {
+    // nodes are immutable, so the copies are built back to front
+    std::vector<const RNode*> originals;
+    originals.reserve(static_cast<std::size_t>(count));
+    const RNode* node = head.load(std::memory_order_relaxed);
+    for (int i = 0; i < count; ++i) {
+        originals.push_back(node);
+        node = node->next;
+    }
+    const RNode* newHead = tail;
+    for (auto it = originals.rbegin(); it != originals.rend(); ++it) {
+        newHead = new RNode((*it)->value, newHead);
+    }
+
+    // the single pointer swap that makes the new version visible
+    head.store(newHead, std::memory_order_release);
+    length.store(newLength, std::memory_order_relaxed);
+
+    // readers that started before the swap may still be on these
+    for (const RNode* original : originals) {
+        retire(original);
+    }
+    if (alsoRetired != nullptr) {
+        retire(alsoRetired);
+    }
+}
+
+void RcuList::prepend(const int value) {
+    const std::lock_guard<std::mutex> lock(writeMutex);
+    head.store(new RNode(value, head.load(std::memory_order_relaxed)), std::memory_order_release);
+    length.store(length.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+}
+
+void RcuList::append(const int value) {
+    const std::lock_guard<std::mutex> lock(writeMutex);
+    const int current = length.load(std::memory_order_relaxed);
+    rebuild(current, new RNode(value, nullptr), nullptr, current + 1);
+}
+
+bool RcuList::insert(const int index, const int value) {
+    const std::lock_guard<std::mutex> lock(writeMutex);
+    const int current = length.load(std::memory_order_relaxed);
+    if (index < 0 || index > current)
+        return false;
+    rebuild(index, new RNode(value, nodeAt(index)), nullptr, current + 1);
+    return true;
+}
+
+bool RcuList::remove(const int index) {
+    const std::lock_guard<std::mutex> lock(writeMutex);
+    const int current = length.load(std::memory_order_relaxed);
+    if (index < 0 || index >= current)
+        return false;
+    const RNode* victim = nodeAt(index);
+    rebuild(index, victim->next, victim, current - 1);
+    return true;
+}
+
+bool RcuList::removeValue(const int value) {
+    const std::lock_guard<std::mutex> lock(writeMutex);
+    int index = 0;
+    const RNode* victim = head.load(std::memory_order_relaxed);
+    while (victim != nullptr && victim->value != value) {
+        victim = victim->next;
+        ++index;
+    }
+    if (victim == nullptr)
+        return false;
+    rebuild(index, victim->next, victim, length.load(std::memory_order_relaxed) - 1);
+    return true;
+}
+
+bool RcuList::set(const int index, const int value) {
+    const std::lock_guard<std::mutex> lock(writeMutex);
+    const int current = length.load(std::memory_order_relaxed);
+    if (index < 0 || index >= current)
+        return false;
+    const RNode* old = nodeAt(index);
+    rebuild(index, new RNode(value, old->next), old, current);
+    return true;
+}
+
+void RcuList::clear() {
+    const std::lock_guard<std::mutex> lock(writeMutex);
+    const RNode* node = head.load(std::memory_order_relaxed);
+    head.store(nullptr, std::memory_order_release);
+    length.store(0, std::memory_order_relaxed);
+    while (node != nullptr) {
+        const RNode* next = node->next;
+        retire(node);
+        node = next;
+    }
+}
+
+// Accessors
+
+int RcuList::getLength() const {
+    return length.load(std::memory_order_relaxed);
+}
+
+EpochDomain& RcuList::getDomain() const {
+    return *domain;
+}
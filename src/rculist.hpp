@@ -0,0 +1,85 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "epoch.hpp"
+
+/*
+ * Read-copy-update list of ints for read-mostly data (config, routing tables).
+ *
+ * Published nodes are never modified. A writer builds the changed part of the
+ * list out of new nodes, reusing the unchanged suffix, and publishes it with a
+ * single release store of `head`; the replaced nodes are retired to an
+ * EpochDomain and freed after a grace period, once no reader can still be
+ * walking them. Writers are serialized by a mutex; readers never take it.
+ *
+ * A read pins the thread (by default an Asymmetric EpochDomain, where that is
+ * a plain store to a thread-private slot) and then walks with plain loads:
+ * no lock, no atomic read-modify-write, no shared cache line written, so
+ * read throughput scales with cores and is not disturbed by updates.
+ *
+ * Update cost: prepend O(1); insert, remove and set at index i copy the i
+ * nodes in front of it; append copies the whole list.
+ */
+class RcuList {
+public:
+    RcuList(); // with its own asymmetric EpochDomain
+    explicit RcuList(EpochDomain& domain); // domain must outlive the list
+    ~RcuList(); // no other thread may be using the list
+
+    RcuList(const RcuList&) = delete;
+    RcuList& operator=(const RcuList&) = delete;
+
+    // 🔍 Readers: any number of threads, wait-free with respect to writers
+    bool contains(int value) const;
+    int get(int index) const; // uses INT_MIN as sentinel value
+    std::vector<int> toVector() const; // one consistent version
+
+    // Calls visit(value) for each value of one consistent version
+    template <typename Visitor>
+    void forEach(Visitor visit) const {
+        const EpochDomain::Guard guard(*domain);
+        for (const RNode* node = head.load(std::memory_order_acquire); node; node = node->next) {
+            visit(node->value);
+        }
+    }
+
+    // ✏️ Writers: serialized among themselves
+    void prepend(int value);
+    void append(int value);
+    bool insert(int index, int value); // valid index range: [0, length]
+    bool remove(int index);
+    bool removeValue(int value); // first occurrence
+    bool set(int index, int value);
+    void clear();
+
+    // 👀 Accessors
+    int getLength() const; // length of the latest published version
+    EpochDomain& getDomain() const;
+
+private:
+    struct RNode {
+        RNode(int value, const RNode* next);
+
+        const int value;
+        const RNode* const next;
+    };
+
+    /*
+     * Publishes a version made of copies of the first `count` nodes followed
+     * by `tail` (unchanged nodes, possibly behind new ones), then retires the
+     * copied originals and `alsoRetired`. Caller holds writeMutex.
+     */
+    void rebuild(int count, const RNode* tail, const RNode* alsoRetired, int newLength);
+    const RNode* nodeAt(int index) const; // nullptr past the end
+    void retire(const RNode* node);
+
+    std::unique_ptr<EpochDomain> ownedDomain;
+    EpochDomain* domain;
+    std::atomic<const RNode*> head;
+    std::atomic<int> length;
+    std::mutex writeMutex;
+};
@@ -0,0 +1,85 @@
+#include "shardedqueue.hpp"
+
+#include <algorithm>
+#include <climits>
+#include <thread>
+
+namespace {
+// Threads are numbered in order of first use and spread over the shards
+std::atomic<unsigned> nextThreadIndex{0};
+thread_local const unsigned threadIndex = nextThreadIndex.fetch_add(1, std::memory_order_relaxed);
+
+int defaultShardCount() {
+    return static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+}
+} // namespace
+
+ShardedQueue::Shard::Shard()
+    : size{0},
+      stolen{0} {
+}
+
+ShardedQueue::ShardedQueue(const int shardCount)
+    : shardCount{shardCount > 0 ? shardCount : defaultShardCount()},
+      shards{std::make_unique<Shard[]>(static_cast<std::size_t>(this->shardCount))} {
+}
+
+ShardedQueue::~ShardedQueue() = default;
+
+// APIs
+
+void ShardedQueue::enQueue(const int value) {
+    Shard& shard = shards[getLocalShard()];
+    const std::lock_guard<std::mutex> lock(shard.mutex);
+    shard.queue.enQueue(value);
+    shard.size.store(shard.queue.getSize(), std::memory_order_relaxed);
+}
+
+int ShardedQueue::deQueue() {
+    const int local = getLocalShard();
+    for (int i = 0; i < shardCount; ++i) {
+        Shard& shard = shards[(local + i) % shardCount];
+        if (shard.size.load(std::memory_order_relaxed) == 0)
+            continue;
+        const std::lock_guard<std::mutex> lock(shard.mutex);
+        if (shard.queue.getSize() == 0)
+            continue; // somebody else got there first
+        const int value = shard.queue.deQueue();
+        shard.size.store(shard.queue.getSize(), std::memory_order_relaxed);
+        if (i != 0)
+            ++shard.stolen;
+        return value;
+    }
+    return INT_MIN;
+}
+
+// Accessors
+
+int ShardedQueue::getSize() const {
+    int total = 0;
+    for (int i = 0; i < shardCount; ++i) {
+        total += shards[i].size.load(std::memory_order_relaxed);
+    }
+    return total;
+}
+
+bool ShardedQueue::isEmpty() const {
+    return getSize() == 0;
+}
+
+int ShardedQueue::getShardCount() const {
+    return shardCount;
+}
+
+int ShardedQueue::getLocalShard() const {
+    return static_cast<int>(threadIndex % static_cast<unsigned>(shardCount));
+}
+
+long long ShardedQueue::getStealCount() const {
+    long long total = 0;
+    for (int i = 0; i < shardCount; ++i) {
+        const std::lock_guard<std::mutex> lock(shards[i].mutex);
+        total += shards[i].stolen;
+    }
+    return total;
+}
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+
+#include "queue.hpp"
+
+/*
+ * Multi-producer, multi-consumer queue of ints split into shards, one per
+ * core by default, each a Queue behind its own mutex on its own cache lines.
+ *
+ * enQueue() always goes to the calling thread's shard, and deQueue() tries
+ * that shard first and then steals from the others round-robin. Threads on
+ * different shards touch disjoint locks and nodes, so there is no single
+ * head/tail line for every core to fight over.
+ *
+ * Ordering is relaxed: values enqueued by one thread come out in the order
+ * they went in (they all sit in one FIFO shard), but values from different
+ * producers may be dequeued in any order. Good for task fan-out, not for a
+ * global FIFO.
+ */
+class ShardedQueue {
+public:
+    static constexpr std::size_t kCacheLine = 64;
+
+    explicit ShardedQueue(int shardCount = 0); // 0: one shard per hardware thread
+    ~ShardedQueue();
+
+    ShardedQueue(const ShardedQueue&) = delete;
+    ShardedQueue& operator=(const ShardedQueue&) = delete;
+
+    // 🚀 APIs, safe to call from any number of threads
+    void enQueue(int value);
+    /*
+     * Uses INT_MIN as sentinel value when every shard was empty as it was
+     * visited; a value enqueued concurrently into a shard already passed
+     * may be missed.
+     */
+    int deQueue();
+
+    // 👀 Accessors (exact only while no other thread is using the queue)
+    int getSize() const;
+    bool isEmpty() const;
+    int getShardCount() const;
+    int getLocalShard() const; // the shard this thread enqueues to
+    long long getStealCount() const; // values dequeued from a non-local shard
+
+private:
+    struct alignas(kCacheLine) Shard {
+        Shard();
+
+        std::mutex mutex;
+        Queue queue;
+        std::atomic<int> size; // lets deQueue() skip empty shards without locking
+        long long stolen; // guarded by mutex
+    };
+
+    const int shardCount;
+    std::unique_ptr<Shard[]> shards;
+};
@@ -0,0 +1,416 @@
+#include "simdscan.hpp"
+
+#include <climits>
+
+#if defined(__x86_64__)
+#define SIMDSCAN_X86 1
+#include <immintrin.h>
+#else
+#define SIMDSCAN_X86 0
+#endif
+
+namespace simd {
+namespace {
+
+// binaryToDecimal only depends on the last 32 values: anything earlier has
+// been shifted out of a 32-bit result
+constexpr std::size_t kPackWindow = 32;
+
+// ------ Scalar ------
+
+std::ptrdiff_t findScalar(const int* data, std::size_t count, int value) {
+    for (std::size_t i = 0; i < count; ++i) {
+        if (data[i] == value)
+            return static_cast<std::ptrdiff_t>(i);
+    }
+    return -1;
+}
+
+std::size_t countLessScalar(const int* data, std::size_t count, int limit) {
+    std::size_t total = 0;
+    for (std::size_t i = 0; i < count; ++i) {
+        total += data[i] < limit ? 1 : 0;
+    }
+    return total;
+}
+
+int minScalar(const int* data, std::size_t count) {
+    int result = INT_MAX;
+    for (std::size_t i = 0; i < count; ++i) {
+        result = data[i] < result ? data[i] : result;
+    }
+    return result;
+}
+
+int maxScalar(const int* data, std::size_t count) {
+    int result = INT_MIN;
+    for (std::size_t i = 0; i < count; ++i) {
+        result = data[i] > result ? data[i] : result;
+    }
+    return result;
+}
+
+long long sumScalar(const int* data, std::size_t count) {
+    long long total = 0;
+    for (std::size_t i = 0; i < count; ++i) {
+        total += data[i];
+    }
+    return total;
+}
+
+int packBitsScalar(const int* data, std::size_t count) {
+    const std::size_t start = count > kPackWindow ? count - kPackWindow : 0;
+    std::uint32_t num = 0;
+    for (std::size_t i = start; i < count; ++i) {
+        num = num * 2u + static_cast<std::uint32_t>(data[i]);
+    }
+    return static_cast<int>(num);
+}
+
+constexpr Kernels kScalarKernels{
+    findScalar,
+    countLessScalar,
+    minScalar,
+    maxScalar,
+    sumScalar,
+    packBitsScalar,
+};
+
+#if SIMDSCAN_X86
+
+// ------ SSE4.1 (4 lanes) ------
+
+__attribute__((target("sse4.1"))) std::ptrdiff_t findSse41(
+    const int* data,
+    std::size_t count,
+    int value) {
+    const __m128i needle = _mm_set1_epi32(value);
+    std::size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        const __m128i block =
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+        const int mask =
+            _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(block, needle)));
+        if (mask != 0)
+            return static_cast<std::ptrdiff_t>(i + __builtin_ctz(mask));
+    }
+    const std::ptrdiff_t rest = findScalar(data + i, count - i, value);
+    return rest < 0 ? -1 : static_cast<std::ptrdiff_t>(i) + rest;
+}
+
+__attribute__((target("sse4.1"))) std::size_t countLessSse41(
+    const int* data,
+    std::size_t count,
+    int limit) {
+    const __m128i bound = _mm_set1_epi32(limit);
+    std::size_t total = 0;
+    std::size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        const __m128i block =
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+        const int mask =
+            _mm_movemask_ps(_mm_castsi128_ps(_mm_cmplt_epi32(block, bound)));
+        total += static_cast<std::size_t>(__builtin_popcount(mask));
+    }
+    return total + countLessScalar(data + i, count - i, limit);
+}
+
+__attribute__((target("sse4.1"))) int minSse41(
+    const int* data,
+    std::size_t count) {
+    __m128i best = _mm_set1_epi32(INT_MAX);
+    std::size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        best = _mm_min_epi32(
+            best,
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i)));
+    }
+    best = _mm_min_epi32(best, _mm_shuffle_epi32(best, 0x4E));
+    best = _mm_min_epi32(best, _mm_shuffle_epi32(best, 0xB1));
+    const int rest = minScalar(data + i, count - i);
+    const int vectorMin = _mm_cvtsi128_si32(best);
+    return rest < vectorMin ? rest : vectorMin;
+}
+
+__attribute__((target("sse4.1"))) int maxSse41(
+    const int* data,
+    std::size_t count) {
+    __m128i best = _mm_set1_epi32(INT_MIN);
+    std::size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        best = _mm_max_epi32(
+            best,
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i)));
+    }
+    best = _mm_max_epi32(best, _mm_shuffle_epi32(best, 0x4E));
+    best = _mm_max_epi32(best, _mm_shuffle_epi32(best, 0xB1));
+    const int rest = maxScalar(data + i, count - i);
+    const int vectorMax = _mm_cvtsi128_si32(best);
+    return rest > vectorMax ? rest : vectorMax;
+}
+
+__attribute__((target("sse4.1"))) long long sumSse41(
+    const int* data,
+    std::size_t count) {
+    // widen to 64-bit lanes so long ranges cannot overflow
+    __m128i low = _mm_setzero_si128();
+    __m128i high = _mm_setzero_si128();
+    std::size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        const __m128i block =
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+        low = _mm_add_epi64(low, _mm_cvtepi32_epi64(block));
+        high = _mm_add_epi64(
+            high, _mm_cvtepi32_epi64(_mm_unpackhi_epi64(block, block)));
+    }
+    const __m128i total = _mm_add_epi64(low, high);
+    return _mm_cvtsi128_si64(total) + _mm_extract_epi64(total, 1) +
+        sumScalar(data + i, count - i);
+}
+
+__attribute__((target("sse4.1"))) int packBitsSse41(
+    const int* data,
+    std::size_t count) {
+    // value i contributes value << (count - 1 - i); SSE has no per-lane
+    // variable shift, so multiply by the matching power of two instead
+    const std::size_t start = count > kPackWindow ? count - kPackWindow : 0;
+    __m128i acc = _mm_setzero_si128();
+    std::size_t i = start;
+    for (; i + 4 <= count; i += 4) {
+        const unsigned shift = static_cast<unsigned>(count - 1 - i);
+        const __m128i weights = _mm_setr_epi32(
+            static_cast<int>(1u << shift),
+            static_cast<int>(1u << (shift - 1)),
+            static_cast<int>(1u << (shift - 2)),
+            static_cast<int>(1u << (shift - 3)));
+        const __m128i block =
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+        acc = _mm_add_epi32(acc, _mm_mullo_epi32(block, weights));
+    }
+    acc = _mm_add_epi32(acc, _mm_shuffle_epi32(acc, 0x4E));
+    acc = _mm_add_epi32(acc, _mm_shuffle_epi32(acc, 0xB1));
+
+    std::uint32_t num = static_cast<std::uint32_t>(_mm_cvtsi128_si32(acc));
+    for (; i < count; ++i) {
+        num += static_cast<std::uint32_t>(data[i]) << (count - 1 - i);
+    }
+    return static_cast<int>(num);
+}
+
+constexpr Kernels kSse41Kernels{
+    findSse41,
+    countLessSse41,
+    minSse41,
+    maxSse41,
+    sumSse41,
+    packBitsSse41,
+};
+
+// ------ AVX2 (8 lanes) ------
+
+__attribute__((target("avx2"))) std::ptrdiff_t findAvx2(
+    const int* data,
+    std::size_t count,
+    int value) {
+    const __m256i needle = _mm256_set1_epi32(value);
+    std::size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        const __m256i block =
+            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+        const int mask = _mm256_movemask_ps(
+            _mm256_castsi256_ps(_mm256_cmpeq_epi32(block, needle)));
+        if (mask != 0)
+            return static_cast<std::ptrdiff_t>(i + __builtin_ctz(mask));
+    }
+    const std::ptrdiff_t rest = findScalar(data + i, count - i, value);
+    return rest < 0 ? -1 : static_cast<std::ptrdiff_t>(i) + rest;
+}
+
+__attribute__((target("avx2"))) std::size_t countLessAvx2(
+    const int* data,
+    std::size_t count,
+    int limit) {
+    const __m256i bound = _mm256_set1_epi32(limit);
+    std::size_t total = 0;
+    std::size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        const __m256i block =
+            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+        const int mask = _mm256_movemask_ps(
+            _mm256_castsi256_ps(_mm256_cmpgt_epi32(bound, block)));
+        total += static_cast<std::size_t>(__builtin_popcount(mask));
+    }
+    return total + countLessScalar(data + i, count - i, limit);
+}
+
+__attribute__((target("avx2"))) int minAvx2(
+    const int* data,
+    std::size_t count) {
+    __m256i best = _mm256_set1_epi32(INT_MAX);
+    std::size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        best = _mm256_min_epi32(
+            best,
+            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i)));
+    }
+    __m128i half = _mm_min_epi32(
+        _mm256_castsi256_si128(best), _mm256_extracti128_si256(best, 1));
+    half = _mm_min_epi32(half, _mm_shuffle_epi32(half, 0x4E));
+    half = _mm_min_epi32(half, _mm_shuffle_epi32(half, 0xB1));
+    const int rest = minScalar(data + i, count - i);
+    const int vectorMin = _mm_cvtsi128_si32(half);
+    return rest < vectorMin ? rest : vectorMin;
+}
+
+__attribute__((target("avx2"))) int maxAvx2(
+    const int* data,
+    std::size_t count) {
+    __m256i best = _mm256_set1_epi32(INT_MIN);
+    std::size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        best = _mm256_max_epi32(
+            best,
+            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i)));
+    }
+    __m128i half = _mm_max_epi32(
+        _mm256_castsi256_si128(best), _mm256_extracti128_si256(best, 1));
+    half = _mm_max_epi32(half, _mm_shuffle_epi32(half, 0x4E));
+    half = _mm_max_epi32(half, _mm_shuffle_epi32(half, 0xB1));
+    const int rest = maxScalar(data + i, count - i);
+    const int vectorMax = _mm_cvtsi128_si32(half);
+    return rest > vectorMax ? rest : vectorMax;
+}
+
+__attribute__((target("avx2"))) long long sumAvx2(
+    const int* data,
+    std::size_t count) {
+    __m256i low = _mm256_setzero_si256();
+    __m256i high = _mm256_setzero_si256();
+    std::size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        const __m256i block =
+            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+        low = _mm256_add_epi64(
+            low, _mm256_cvtepi32_epi64(_mm256_castsi256_si128(block)));
+        high = _mm256_add_epi64(
+            high, _mm256_cvtepi32_epi64(_mm256_extracti128_si256(block, 1)));
+    }
+    const __m256i total = _mm256_add_epi64(low, high);
+    const __m128i folded = _mm_add_epi64(
+        _mm256_castsi256_si128(total), _mm256_extracti128_si256(total, 1));
+    return _mm_cvtsi128_si64(folded) + _mm_extract_epi64(folded, 1) +
+        sumScalar(data + i, count - i);
+}
+
+__attribute__((target("avx2"))) int packBitsAvx2(
+    const int* data,
+    std::size_t count) {
+    const std::size_t start = count > kPackWindow ? count - kPackWindow : 0;
+    const __m256i lane = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+    __m256i acc = _mm256_setzero_si256();
+    std::size_t i = start;
+    for (; i + 8 <= count; i += 8) {
+        const __m256i shifts = _mm256_sub_epi32(
+            _mm256_set1_epi32(static_cast<int>(count - 1 - i)), lane);
+        const __m256i block =
+            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+        acc = _mm256_add_epi32(acc, _mm256_sllv_epi32(block, shifts));
+    }
+    __m128i half = _mm_add_epi32(
+        _mm256_castsi256_si128(acc), _mm256_extracti128_si256(acc, 1));
+    half = _mm_add_epi32(half, _mm_shuffle_epi32(half, 0x4E));
+    half = _mm_add_epi32(half, _mm_shuffle_epi32(half, 0xB1));
+
+    std::uint32_t num = static_cast<std::uint32_t>(_mm_cvtsi128_si32(half));
+    for (; i < count; ++i) {
+        num += static_cast<std::uint32_t>(data[i]) << (count - 1 - i);
+    }
+    return static_cast<int>(num);
+}
+
+constexpr Kernels kAvx2Kernels{
+    findAvx2,
+    countLessAvx2,
+    minAvx2,
+    maxAvx2,
+    sumAvx2,
+    packBitsAvx2,
+};
+
+#endif // SIMDSCAN_X86
+
+Level detect() {
+#if SIMDSCAN_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2"))
+        return Level::AVX2;
+    if (__builtin_cpu_supports("sse4.1"))
+        return Level::SSE41;
+#endif
+    return Level::Scalar;
+}
+
+} // namespace
+
+Level detectedLevel() {
+    static const Level level = detect();
+    return level;
+}
+
+const char* levelName(const Level level) {
+    switch (level) {
+        case Level::AVX2:
+            return "avx2";
+        case Level::SSE41:
+            return "sse4.1";
+        default:
+            return "scalar";
+    }
+}
+
+const Kernels& kernelsFor(const Level level) {
+#if SIMDSCAN_X86
+    // never hand out kernels the CPU cannot execute
+    const Level supported = detectedLevel();
+    if (level == Level::AVX2 && supported == Level::AVX2)
+        return kAvx2Kernels;
+    if (level == Level::SSE41 && supported != Level::Scalar)
+        return kSse41Kernels;
+#else
+    (void)level;
+#endif
+    return kScalarKernels;
+}
+
+namespace {
+const Kernels& active() {
+    static const Kernels& kernels = kernelsFor(detectedLevel());
+    return kernels;
+}
+} // namespace
+
+std::ptrdiff_t find(const int* data, std::size_t count, int value) {
+    return active().find(data, count, value);
+}
+
+std::size_t countLess(const int* data, std::size_t count, int limit) {
+    return active().countLess(data, count, limit);
+}
+
+int minValue(const int* data, std::size_t count) {
+    return active().minValue(data, count);
+}
+
+int maxValue(const int* data, std::size_t count) {
+    return active().maxValue(data, count);
+}
+
+long long sum(const int* data, std::size_t count) {
+    return active().sum(data, count);
+}
+
+int packBits(const int* data, std::size_t count) {
+    return active().packBits(data, count);
+}
+
+} // namespace simd
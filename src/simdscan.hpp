@@ -0,0 +1,58 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+/*
+ * Vectorised scans over contiguous int arrays.
+ *
+ * The list algorithms that look at every value (find, counting values below a
+ * limit, min/max, sums, binaryToDecimal's bit accumulation) are a
+ * compare-and-branch per node when walking pointers. Once the values are laid
+ * out contiguously (e.g. IndexedLinkedList after compact()), the same scans
+ * can process 4 or 8 values per instruction.
+ *
+ * Every kernel has a portable scalar version plus SSE4.1 and AVX2 versions on
+ * x86. The best level the CPU supports is detected once at runtime, so the
+ * library is built for the baseline ISA and still uses AVX2 where available.
+ */
+namespace simd {
+
+enum class Level {
+    Scalar,
+    SSE41,
+    AVX2,
+};
+
+// One implementation of every kernel for a given instruction set
+struct Kernels {
+    // index of the first element equal to value, or -1
+    std::ptrdiff_t (*find)(const int* data, std::size_t count, int value);
+    // number of elements strictly less than limit
+    std::size_t (*countLess)(const int* data, std::size_t count, int limit);
+    // INT_MAX / INT_MIN for an empty range
+    int (*minValue)(const int* data, std::size_t count);
+    int (*maxValue)(const int* data, std::size_t count);
+    long long (*sum)(const int* data, std::size_t count);
+    // num = num * 2 + data[i] over the range, in wrapping 32-bit arithmetic
+    int (*packBits)(const int* data, std::size_t count);
+};
+
+// Best level supported by the running CPU (cached after the first call)
+Level detectedLevel();
+
+const char* levelName(Level level);
+
+// Kernels for a specific level; falls back to scalar if the level is not
+// supported by this CPU or build
+const Kernels& kernelsFor(Level level);
+
+// Convenience wrappers that dispatch to kernelsFor(detectedLevel())
+std::ptrdiff_t find(const int* data, std::size_t count, int value);
+std::size_t countLess(const int* data, std::size_t count, int limit);
+int minValue(const int* data, std::size_t count);
+int maxValue(const int* data, std::size_t count);
+long long sum(const int* data, std::size_t count);
+int packBits(const int* data, std::size_t count);
+
+} // namespace simd
@@ -1,9 +1,38 @@
 #include "stack.hpp"
+#include <climits>
 #include <iostream>
+#include <new>
 
-Stack::Stack(const int data) {
-    top = new SNode(data);
+Stack::Stack(std::pmr::memory_resource* resource)
+    : top{nullptr},
+      height{0},
+      resource{resource} {
+}
+
+Stack::Stack(const int data, std::pmr::memory_resource* resource)
+    : resource{resource} {
+    top = createNode(data);
     height = 1;
+    stats.recordInsert(height);
+}
+
+// Node allocation: every node the stack owns is created and destroyed here
+SNode* Stack::createNode(const int value) {
+    stats.recordAllocation(sizeof(SNode));
+    if (resource) {
+        return new (resource->allocate(sizeof(SNode), alignof(SNode))) SNode(value);
+    }
+    return new SNode(value);
+}
+
+void Stack::destroyNode(SNode* node) {
+    stats.recordDeallocation(sizeof(SNode));
+    if (resource) {
+        node->~SNode();
+        resource->deallocate(node, sizeof(SNode), alignof(SNode));
+        return;
+    }
+    delete node;
 }
 
 Stack::~Stack() {
@@ -16,7 +45,7 @@ void Stack::clear() {
 
     while (current) {
         SNode* next = current->next;
-        delete current;
+        destroyNode(current);
         current = next;
     }
     top = nullptr;
@@ -42,23 +71,40 @@ int Stack::getHeight() const {
 }
 
 void Stack::push(const int value) {
-    auto* newNode = new SNode(value);
+    auto* newNode = createNode(value);
     newNode->next = top;
     top = newNode;
     ++height;
+    stats.recordInsert(height);
 }
 
 int Stack::pop() {
-    if (height == 0) return INT_MIN;
+    if (height == 0) {
+        stats.recordEmptyRemoval();
+        return INT_MIN;
+    }
     SNode* temp = top;
     const int poppedValue = top->data;
     top = top->next;
-    delete temp;
+    destroyNode(temp);
     --height;
+    stats.recordRemoval();
     return poppedValue;
 }
 
 int Stack::peek() const {
     if (height == 0) return INT_MIN;
     return top->data;
-}
\ No newline at end of file
+}
+
+std::pmr::memory_resource* Stack::getResource() const {
+    return resource;
+}
+
+StatsSnapshot Stack::getStats() const {
+    return stats.snapshot();
+}
+
+void Stack::resetStats() {
+    stats.reset();
+}
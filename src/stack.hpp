@@ -1,5 +1,9 @@
 #pragma once
 
+#include <memory_resource>
+
+#include "containerstats.hpp"
+
 class SNode {
 public:
     int data;
@@ -14,7 +18,13 @@ public:
 
 class Stack {
 public:
-    explicit Stack(int data);
+    /*
+     * Nodes are allocated from `resource` (a pool, monotonic or NUMA-local
+     * std::pmr::memory_resource) when one is given, and with plain new/delete
+     * otherwise. The resource must outlive the stack.
+     */
+    explicit Stack(std::pmr::memory_resource* resource = nullptr); // empty stack
+    explicit Stack(int data, std::pmr::memory_resource* resource = nullptr);
     ~Stack();
     void clear();
     void display() const;
@@ -23,7 +33,19 @@ public:
     int pop(); // uses INT_MIN as sentinel value
     int peek() const; // uses INT_MIN as sentinel value
 
+    // nullptr when nodes come from the global heap
+    std::pmr::memory_resource* getResource() const;
+
+    // 📊 Usage counters (all zero unless built with ENABLE_CONTAINER_STATS)
+    StatsSnapshot getStats() const;
+    void resetStats();
+
 private:
+    SNode* createNode(int value);
+    void destroyNode(SNode* node);
+
     SNode* top;
     int height;
+    std::pmr::memory_resource* resource;
+    [[no_unique_address]] ContainerStats stats;
 };
\ No newline at end of file
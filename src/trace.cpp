@@ -0,0 +1,242 @@
+#include "trace.hpp"
+
+#include <algorithm>
+#include <array>
+#include <fstream>
+#include <istream>
+#include <limits>
+#include <ostream>
+#include <sstream>
+
+namespace {
+constexpr int kOpCount = static_cast<int>(TraceOp::Clear) + 1;
+
+struct OpInfo {
+    const char* name;
+    bool hasIndex;
+    bool hasValue;
+};
+
+constexpr std::array<OpInfo, kOpCount> kOps{{
+    {"append", false, true},
+    {"prepend", false, true},
+    {"insert", true, true},
+    {"get", true, false},
+    {"set", true, true},
+    {"deleteNode", true, false},
+    {"deleteFirst", false, false},
+    {"deleteLast", false, false},
+    {"push", false, true},
+    {"pop", false, false},
+    {"enQueue", false, true},
+    {"deQueue", false, false},
+    {"clear", false, false},
+}};
+
+const OpInfo& infoOf(const TraceOp op) {
+    return kOps[static_cast<std::size_t>(op)];
+}
+
+// Zig-zag maps small negative numbers to small unsigned ones: 0, -1, 1, -2 ...
+void writeVarint(std::ostream& out, const int value) {
+    auto bits = (static_cast<std::uint32_t>(value) << 1) ^ static_cast<std::uint32_t>(value >> 31);
+    while (bits >= 0x80) {
+        out.put(static_cast<char>((bits & 0x7F) | 0x80));
+        bits >>= 7;
+    }
+    out.put(static_cast<char>(bits));
+}
+
+bool readVarint(std::istream& in, int& value) {
+    std::uint32_t bits = 0;
+    for (int shift = 0; shift < 35; shift += 7) {
+        const int byte = in.get();
+        if (byte == std::char_traits<char>::eof())
+            return false;
+        bits |= static_cast<std::uint32_t>(byte & 0x7F) << shift;
+        if ((byte & 0x80) == 0) {
+            value = static_cast<int>((bits >> 1) ^ (~(bits & 1) + 1));
+            return true;
+        }
+    }
+    return false; // more than 5 bytes: not an int
+}
+
+bool parseInt(const std::string& text, int& value) {
+    try {
+        std::size_t used = 0;
+        const long long parsed = std::stoll(text, &used);
+        if (used != text.size() || parsed < std::numeric_limits<int>::min() ||
+            parsed > std::numeric_limits<int>::max())
+            return false;
+        value = static_cast<int>(parsed);
+        return true;
+    } catch (const std::exception&) {
+        return false;
+    }
+}
+} // namespace
+
+// Loading
+
+bool Trace::loadFile(const std::string& path, std::string& error) {
+    std::ifstream in(path, std::ios::binary);
+    if (!in) {
+        error = "cannot open " + path;
+        return false;
+    }
+    char magic[sizeof(kMagic)] = {};
+    in.read(magic, sizeof(magic));
+    const bool binary = in.gcount() == sizeof(magic) &&
+                        std::equal(magic, magic + sizeof(magic), kMagic);
+    in.clear();
+    in.seekg(0);
+    return binary ? parseBinary(in, error) : parseText(in, error);
+}
+
+bool Trace::parseText(std::istream& in, std::string& error) {
+    std::string line;
+    for (int lineNumber = 1; std::getline(in, line); ++lineNumber) {
+        const std::size_t hash = line.find('#');
+        if (hash != std::string::npos)
+            line.erase(hash);
+        std::istringstream words(line);
+        std::string name;
+        if (!(words >> name))
+            continue; // blank or comment-only line
+
+        TraceRecord record{};
+        if (!parseOpName(name, record.op)) {
+            error = "line " + std::to_string(lineNumber) + ": unknown operation '" + name + "'";
+            return false;
+        }
+        const OpInfo& info = infoOf(record.op);
+        std::string word;
+        bool ok = true;
+        if (info.hasIndex)
+            ok = (words >> word) && parseInt(word, record.index);
+        if (ok && info.hasValue)
+            ok = (words >> word) && parseInt(word, record.value);
+        if (ok && (words >> word))
+            ok = false; // trailing garbage
+        if (!ok) {
+            error = "line " + std::to_string(lineNumber) + ": '" + name + "' takes " +
+                    std::to_string(argumentCount(record.op)) + " integer argument(s)";
+            return false;
+        }
+        records.push_back(record);
+    }
+    return true;
+}
+
+bool Trace::parseBinary(std::istream& in, std::string& error) {
+    char header[sizeof(kMagic) + 1] = {};
+    in.read(header, sizeof(header));
+    if (in.gcount() != sizeof(header) || !std::equal(kMagic, kMagic + sizeof(kMagic), header)) {
+        error = "not a binary trace (missing DSTR header)";
+        return false;
+    }
+    if (static_cast<std::uint8_t>(header[sizeof(kMagic)]) != kVersion) {
+        error = "unsupported binary trace version " +
+                std::to_string(static_cast<std::uint8_t>(header[sizeof(kMagic)]));
+        return false;
+    }
+
+    while (true) {
+        const std::streamoff offset = in.tellg();
+        const int opcode = in.get();
+        if (opcode == std::char_traits<char>::eof())
+            return true;
+        if (opcode >= kOpCount) {
+            error = "byte " + std::to_string(offset) + ": unknown opcode " + std::to_string(opcode);
+            return false;
+        }
+        TraceRecord record{static_cast<TraceOp>(opcode), 0, 0};
+        const OpInfo& info = infoOf(record.op);
+        if ((info.hasIndex && !readVarint(in, record.index)) ||
+            (info.hasValue && !readVarint(in, record.value))) {
+            error = "byte " + std::to_string(offset) + ": truncated '" + info.name + "' record";
+            return false;
+        }
+        records.push_back(record);
+    }
+}
+
+// Saving
+
+void Trace::writeText(std::ostream& out) const {
+    for (const TraceRecord& record : records) {
+        const OpInfo& info = infoOf(record.op);
+        out << info.name;
+        if (info.hasIndex)
+            out << ' ' << record.index;
+        if (info.hasValue)
+            out << ' ' << record.value;
+        out << '\n';
+    }
+}
+
+void Trace::writeBinary(std::ostream& out) const {
+    out.write(kMagic, sizeof(kMagic));
+    out.put(static_cast<char>(kVersion));
+    for (const TraceRecord& record : records) {
+        const OpInfo& info = infoOf(record.op);
+        out.put(static_cast<char>(record.op));
+        if (info.hasIndex)
+            writeVarint(out, record.index);
+        if (info.hasValue)
+            writeVarint(out, record.value);
+    }
+}
+
+bool Trace::saveFile(const std::string& path, const bool binary, std::string& error) const {
+    std::ofstream out(path, binary ? std::ios::binary : std::ios::out);
+    if (binary) {
+        writeBinary(out);
+    } else {
+        writeText(out);
+    }
+    if (!out) {
+        error = "cannot write " + path;
+        return false;
+    }
+    return true;
+}
+
+// APIs
+
+void Trace::add(const TraceRecord& record) {
+    records.push_back(record);
+}
+
+void Trace::clear() {
+    records.clear();
+}
+
+// Accessors
+
+const std::vector<TraceRecord>& Trace::getRecords() const {
+    return records;
+}
+
+int Trace::getSize() const {
+    return static_cast<int>(records.size());
+}
+
+const char* Trace::opName(const TraceOp op) {
+    return infoOf(op).name;
+}
+
+int Trace::argumentCount(const TraceOp op) {
+    return static_cast<int>(infoOf(op).hasIndex) + static_cast<int>(infoOf(op).hasValue);
+}
+
+bool Trace::parseOpName(const std::string& name, TraceOp& op) {
+    for (int i = 0; i < kOpCount; ++i) {
+        if (name == kOps[static_cast<std::size_t>(i)].name) {
+            op = static_cast<TraceOp>(i);
+            return true;
+        }
+    }
+    return false;
+}
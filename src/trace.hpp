@@ -0,0 +1,83 @@
+#pragma once
+
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+// Container operations a workload trace can record
+enum class TraceOp : std::uint8_t {
+    Append,
+    Prepend,
+    Insert, // index, value
+    Get, // index
+    Set, // index, value
+    DeleteNode, // index
+    DeleteFirst,
+    DeleteLast,
+    Push, // value
+    Pop,
+    EnQueue, // value
+    DeQueue,
+    Clear,
+};
+
+struct TraceRecord {
+    TraceOp op;
+    int index; // 0 when the operation takes no index
+    int value; // 0 when the operation takes no value
+
+    bool operator==(const TraceRecord&) const = default;
+};
+
+/*
+ * A recorded sequence of container operations, for replaying production
+ * workloads against different implementations (see dsApp).
+ *
+ * Text format: one operation per line, named as in the container APIs and
+ * followed by its arguments; blank lines and '#' comments are skipped.
+ *
+ *     # index first, then value
+ *     append 5
+ *     insert 0 7
+ *     get 1
+ *     deQueue
+ *
+ * Binary format: the magic "DSTR", a version byte, then per operation one
+ * opcode byte and its arguments as zig-zag LEB128 varints, so small numbers
+ * take one byte. A typical trace is 2-4 bytes per operation.
+ *
+ * Load errors are reported through a message (with the line or byte offset)
+ * and a false return; the trace keeps the records read before the error.
+ */
+class Trace {
+public:
+    static constexpr char kMagic[4] = {'D', 'S', 'T', 'R'};
+    static constexpr std::uint8_t kVersion = 1;
+
+    // 📥 Loading: the file format is detected from the magic
+    bool loadFile(const std::string& path, std::string& error);
+    bool parseText(std::istream& in, std::string& error);
+    bool parseBinary(std::istream& in, std::string& error); // expects the header
+
+    // 📤 Saving
+    void writeText(std::ostream& out) const;
+    void writeBinary(std::ostream& out) const;
+    bool saveFile(const std::string& path, bool binary, std::string& error) const;
+
+    // 🚀 APIs
+    void add(const TraceRecord& record);
+    void clear();
+
+    // 👀 Accessors
+    const std::vector<TraceRecord>& getRecords() const;
+    int getSize() const;
+
+    // Op helpers: API name, argument count, and name lookup
+    static const char* opName(TraceOp op);
+    static int argumentCount(TraceOp op);
+    static bool parseOpName(const std::string& name, TraceOp& op);
+
+private:
+    std::vector<TraceRecord> records;
+};
@@ -0,0 +1,255 @@
+#include "xorlinkedlist.hpp"
+
+#include <climits>
+#include <iostream>
+#include <utility>
+
+namespace {
+constexpr std::uint32_t kNull = 0; // slot 0 is never handed out
+}
+
+XorLinkedList::XorLinkedList(const int value)
+    : nodes(1, XNode{0, kNull}),
+      head{kNull},
+      tail{kNull},
+      freeList{kNull},
+      length{0} {
+    append(value);
+}
+
+XorLinkedList::XorLinkedList(XorLinkedList&& other) noexcept
+    : nodes(std::move(other.nodes)),
+      head{other.head},
+      tail{other.tail},
+      freeList{other.freeList},
+      length{other.length} {
+    // leave the source as a valid empty list
+    other.nodes.assign(1, XNode{0, kNull});
+    other.head = other.tail = other.freeList = kNull;
+    other.length = 0;
+}
+
+XorLinkedList& XorLinkedList::operator=(XorLinkedList&& other) noexcept {
+    if (this != &other) {
+        nodes = std::move(other.nodes);
+        head = other.head;
+        tail = other.tail;
+        freeList = other.freeList;
+        length = other.length;
+
+        other.nodes.assign(1, XNode{0, kNull});
+        other.head = other.tail = other.freeList = kNull;
+        other.length = 0;
+    }
+    return *this;
+}
+
+void XorLinkedList::clear() {
+    // keeps the pool's capacity, drops every node but the null slot
+    nodes.resize(1);
+    head = tail = freeList = kNull;
+    length = 0;
+}
+
+int XorLinkedList::getLength() const {
+    return length;
+}
+
+int XorLinkedList::getHead() const {
+    return length == 0 ? INT_MIN : nodes[head].value;
+}
+
+int XorLinkedList::getTail() const {
+    return length == 0 ? INT_MIN : nodes[tail].value;
+}
+
+std::size_t XorLinkedList::memoryUsage() const {
+    return nodes.capacity() * sizeof(XNode);
+}
+
+void XorLinkedList::display() const {
+    std::uint32_t prev = kNull;
+    std::uint32_t current = head;
+
+    std::cout << "{";
+    while (current != kNull) {
+        std::cout << nodes[current].value;
+        const std::uint32_t next = nodes[current].link ^ prev;
+        prev = current;
+        current = next;
+        if (current != kNull) {
+            std::cout << ", ";
+        }
+    }
+    std::cout << "}\n";
+}
+
+std::uint32_t XorLinkedList::allocateNode(const int value) {
+    // reuse a deleted slot before growing the pool
+    if (freeList != kNull) {
+        const std::uint32_t slot = freeList;
+        freeList = nodes[slot].link;
+        nodes[slot] = XNode{value, kNull};
+        return slot;
+    }
+    nodes.push_back(XNode{value, kNull});
+    return static_cast<std::uint32_t>(nodes.size() - 1);
+}
+
+void XorLinkedList::freeNode(const std::uint32_t slot) {
+    nodes[slot].link = freeList;
+    freeList = slot;
+}
+
+void XorLinkedList::append(const int value) {
+    const std::uint32_t newNode = allocateNode(value);
+    if (length == 0) {
+        head = tail = newNode;
+    } else {
+        // new tail: prev = old tail, next = null
+        nodes[newNode].link = tail;
+        // old tail: next was null, now newNode
+        nodes[tail].link ^= newNode;
+        tail = newNode;
+    }
+    ++length;
+}
+
+void XorLinkedList::prepend(const int value) {
+    const std::uint32_t newNode = allocateNode(value);
+    if (length == 0) {
+        head = tail = newNode;
+    } else {
+        nodes[newNode].link = head;
+        nodes[head].link ^= newNode;
+        head = newNode;
+    }
+    ++length;
+}
+
+void XorLinkedList::deleteLast() {
+    if (length == 0)
+        return; // empty list
+
+    const std::uint32_t temp = tail;
+    if (length == 1) {
+        head = tail = kNull;
+    } else {
+        // tail's link is just its prev (next is null)
+        tail = nodes[temp].link;
+        nodes[tail].link ^= temp;
+    }
+    freeNode(temp);
+    --length;
+}
+
+void XorLinkedList::deleteFirst() {
+    if (length == 0)
+        return; // empty list
+
+    const std::uint32_t temp = head;
+    if (length == 1) {
+        head = tail = kNull;
+    } else {
+        head = nodes[temp].link;
+        nodes[head].link ^= temp;
+    }
+    freeNode(temp);
+    --length;
+}
+
+XorLinkedList::Cursor XorLinkedList::walkTo(const int index) const {
+    /*
+     * Same trick as DoublyLinkedList::get: start from whichever end is closer.
+     * Walking from the tail yields the neighbour *after* the target, so it is
+     * converted back to the neighbour before it before returning.
+     */
+    if (index < length / 2) {
+        std::uint32_t prev = kNull;
+        std::uint32_t current = head;
+        for (int i = 0; i < index; ++i) {
+            const std::uint32_t next = nodes[current].link ^ prev;
+            prev = current;
+            current = next;
+        }
+        return Cursor{prev, current};
+    }
+
+    std::uint32_t after = kNull;
+    std::uint32_t current = tail;
+    for (int i = length - 1; i > index; --i) {
+        const std::uint32_t before = nodes[current].link ^ after;
+        after = current;
+        current = before;
+    }
+    return Cursor{nodes[current].link ^ after, current};
+}
+
+int XorLinkedList::get(const int index) const {
+    if (index < 0 || index >= length)
+        return INT_MIN;
+    return nodes[walkTo(index).current].value;
+}
+
+bool XorLinkedList::set(const int index, const int newValue) {
+    if (index < 0 || index >= length)
+        return false;
+    nodes[walkTo(index).current].value = newValue;
+    return true;
+}
+
+bool XorLinkedList::insertNode(const int index, const int value) {
+    // validate index bounds
+    if (index < 0 || index > length)
+        return false;
+
+    if (index == 0) {
+        prepend(value);
+        return true;
+    }
+
+    if (index == length) {
+        append(value);
+        return true;
+    }
+
+    // the new node goes between `before` (index - 1) and `after` (index)
+    const Cursor at = walkTo(index);
+    const std::uint32_t before = at.prev;
+    const std::uint32_t after = at.current;
+    const std::uint32_t newNode = allocateNode(value);
+
+    nodes[newNode].link = before ^ after;
+    nodes[before].link ^= after ^ newNode;
+    nodes[after].link ^= before ^ newNode;
+
+    ++length;
+    return true;
+}
+
+void XorLinkedList::deleteNode(const int index) {
+    if (index < 0 || index >= length)
+        return;
+
+    if (index == 0)
+        return deleteFirst();
+
+    if (index == length - 1)
+        return deleteLast();
+
+    const Cursor at = walkTo(index);
+    const std::uint32_t before = at.prev;
+    const std::uint32_t target = at.current;
+    const std::uint32_t after = nodes[target].link ^ before;
+
+    nodes[before].link ^= target ^ after;
+    nodes[after].link ^= target ^ before;
+    freeNode(target);
+    --length;
+}
+
+void XorLinkedList::reverse() {
+    // every link is symmetric (prev ^ next == next ^ prev), so only the
+    // entry points change
+    std::swap(head, tail);
+}
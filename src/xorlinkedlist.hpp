@@ -0,0 +1,73 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/*
+ * Memory-compact doubly linked list.
+ *
+ * Each node stores a single link field holding (prev XOR next). Knowing one
+ * neighbour is then enough to recover the other, so the list can still be
+ * walked in both directions.
+ *
+ * Links are 32-bit slot indices into one node pool (a std::vector) rather than
+ * raw pointers, so a node is 8 bytes (int + uint32) instead of the 24 bytes of
+ * a DNode, and there is no per-node heap allocation or malloc header on top of
+ * that. Slot 0 is reserved as the "null" index. Deleted slots are recycled
+ * through a free list threaded through the same link field.
+ */
+class XNode {
+public:
+    int value;
+    std::uint32_t link; // prev ^ next (or next free slot when on the free list)
+};
+
+class XorLinkedList {
+public:
+    explicit XorLinkedList(int value);
+    ~XorLinkedList() = default;
+
+    XorLinkedList(const XorLinkedList& other) = default;
+    XorLinkedList& operator=(const XorLinkedList& other) = default;
+
+    XorLinkedList(XorLinkedList&& other) noexcept;
+    XorLinkedList& operator=(XorLinkedList&& other) noexcept;
+
+    void clear();
+    void display() const;
+    void append(int value);
+    void prepend(int value);
+    void deleteLast();
+    void deleteFirst();
+    int get(int index) const; // uses INT_MIN as sentinel value
+    bool set(int index, int newValue);
+    bool insertNode(int index, int value);
+    void deleteNode(int index);
+    void reverse(); // O(1): swapping head and tail flips the direction
+
+    // accessors
+    int getLength() const;
+    int getHead() const; // uses INT_MIN as sentinel value
+    int getTail() const; // uses INT_MIN as sentinel value
+
+    // bytes reserved by the node pool
+    std::size_t memoryUsage() const;
+
+private:
+    // position of a node while walking: the slot and the slot we came from
+    struct Cursor {
+        std::uint32_t prev;
+        std::uint32_t current;
+    };
+
+    Cursor walkTo(int index) const;
+    std::uint32_t allocateNode(int value);
+    void freeNode(std::uint32_t slot);
+
+    std::vector<XNode> nodes;
+    std::uint32_t head;
+    std::uint32_t tail;
+    std::uint32_t freeList;
+    int length;
+};
@@ -0,0 +1,133 @@
+#include <gtest/gtest.h>
+#include <climits>
+#include <vector>
+#include "asyncqueue.hpp"
+#include "coroexecutor.hpp"
+
+namespace {
+CoroTask consumeAll(AsyncQueue& queue, std::vector<int>& out) {
+    for (int value; (value = co_await queue.deQueue()) != INT_MIN;) {
+        out.push_back(value);
+    }
+}
+
+CoroTask consumeOne(AsyncQueue& queue, long long& sum, int& done) {
+    sum += co_await queue.deQueue();
+    ++done;
+}
+
+CoroTask produce(CoroExecutor& executor, AsyncQueue& queue, const int count) {
+    for (int i = 0; i < count; ++i) {
+        queue.enQueue(i);
+        co_await executor.yield();
+    }
+    queue.close();
+}
+} // namespace
+
+TEST(AsyncQueueTest, ValuesQueuedBeforeAnyConsumer) {
+    CoroExecutor executor;
+    AsyncQueue queue;
+    EXPECT_TRUE(queue.enQueue(1));
+    EXPECT_TRUE(queue.enQueue(2));
+    EXPECT_EQ(queue.getSize(), 2);
+
+    std::vector<int> out;
+    executor.spawn(consumeAll(queue, out));
+    executor.run();
+    EXPECT_EQ(out, (std::vector<int>{1, 2}));
+    EXPECT_EQ(queue.getWaiterCount(), 1); // waiting for more
+    EXPECT_EQ(executor.getTaskCount(), 1);
+}
+
+TEST(AsyncQueueTest, EnQueueResumesWaiterDirectly) {
+    CoroExecutor executor;
+    AsyncQueue queue;
+    std::vector<int> out;
+    executor.spawn(consumeAll(queue, out));
+    executor.run();
+    EXPECT_EQ(queue.getWaiterCount(), 1);
+
+    queue.enQueue(7); // no executor involved: the consumer runs right here
+    EXPECT_EQ(out, (std::vector<int>{7}));
+    EXPECT_EQ(queue.getSize(), 0);
+    EXPECT_EQ(executor.getReadyCount(), 0);
+}
+
+TEST(AsyncQueueTest, CloseWakesWaitersAndRejectsEnQueue) {
+    CoroExecutor executor;
+    AsyncQueue queue;
+    std::vector<int> first;
+    std::vector<int> second;
+    executor.spawn(consumeAll(queue, first));
+    executor.spawn(consumeAll(queue, second));
+    executor.run();
+    EXPECT_EQ(queue.getWaiterCount(), 2);
+
+    queue.close();
+    EXPECT_TRUE(queue.isClosed());
+    EXPECT_EQ(queue.getWaiterCount(), 0);
+    EXPECT_EQ(executor.getTaskCount(), 0);
+    EXPECT_FALSE(queue.enQueue(1));
+}
+
+TEST(AsyncQueueTest, ClosedQueueIsDrainedFirst) {
+    CoroExecutor executor;
+    AsyncQueue queue;
+    queue.enQueue(1);
+    queue.close();
+    std::vector<int> out;
+    executor.spawn(consumeAll(queue, out));
+    executor.run();
+    EXPECT_EQ(out, (std::vector<int>{1}));
+    EXPECT_EQ(executor.getTaskCount(), 0);
+}
+
+TEST(AsyncQueueTest, WaitersAreServedInArrivalOrder) {
+    CoroExecutor executor;
+    AsyncQueue queue;
+    std::vector<int> first;
+    std::vector<int> second;
+    executor.spawn(consumeAll(queue, first));
+    executor.spawn(consumeAll(queue, second));
+    executor.spawn(produce(executor, queue, 4));
+    executor.run();
+    // a served consumer re-queues behind the other one
+    EXPECT_EQ(first, (std::vector<int>{0, 2}));
+    EXPECT_EQ(second, (std::vector<int>{1, 3}));
+}
+
+TEST(AsyncQueueTest, ThousandsOfWaitingConsumers) {
+    constexpr int kConsumers = 10000;
+    CoroExecutor executor;
+    AsyncQueue queue;
+    long long sum = 0;
+    int done = 0;
+    for (int i = 0; i < kConsumers; ++i) {
+        executor.spawn(consumeOne(queue, sum, done));
+    }
+    executor.run();
+    EXPECT_EQ(queue.getWaiterCount(), kConsumers);
+
+    for (int i = 0; i < kConsumers; ++i) {
+        queue.enQueue(i);
+    }
+    EXPECT_EQ(done, kConsumers);
+    EXPECT_EQ(sum, static_cast<long long>(kConsumers) * (kConsumers - 1) / 2);
+    EXPECT_EQ(queue.getWaiterCount(), 0);
+}
+
+TEST(AsyncQueueTest, DestroyedWaiterLeavesTheQueue) {
+    AsyncQueue queue;
+    std::vector<int> out;
+    {
+        CoroExecutor executor;
+        executor.spawn(consumeAll(queue, out));
+        executor.run();
+        EXPECT_EQ(queue.getWaiterCount(), 1);
+    }
+    EXPECT_EQ(queue.getWaiterCount(), 0);
+    EXPECT_TRUE(queue.enQueue(5));
+    EXPECT_EQ(queue.getSize(), 1);
+    EXPECT_TRUE(out.empty());
+}
@@ -0,0 +1,196 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <climits>
+#include <numeric>
+#include <thread>
+#include <vector>
+#include "blockingqueue.hpp"
+
+using namespace std::chrono_literals;
+
+TEST(BlockingQueueTest, FifoOrderWithinCapacity) {
+    BlockingQueue queue(4);
+    EXPECT_EQ(queue.getCapacity(), 4);
+    EXPECT_TRUE(queue.push(1));
+    EXPECT_TRUE(queue.push(2));
+    EXPECT_TRUE(queue.push(3));
+    EXPECT_EQ(queue.getSize(), 3);
+    EXPECT_EQ(queue.pop(), 1);
+    EXPECT_EQ(queue.pop(), 2);
+    EXPECT_TRUE(queue.push(4));
+    EXPECT_TRUE(queue.push(5));
+    EXPECT_TRUE(queue.push(6)); // wraps around the ring
+    EXPECT_EQ(queue.pop(), 3);
+    EXPECT_EQ(queue.pop(), 4);
+    EXPECT_EQ(queue.pop(), 5);
+    EXPECT_EQ(queue.pop(), 6);
+    EXPECT_EQ(queue.getSize(), 0);
+}
+
+TEST(BlockingQueueTest, CapacityIsAtLeastOne) {
+    BlockingQueue queue(0);
+    EXPECT_EQ(queue.getCapacity(), 1);
+    EXPECT_TRUE(queue.tryPush(7, 0ms));
+    EXPECT_FALSE(queue.tryPush(8, 0ms));
+}
+
+TEST(BlockingQueueTest, TryVariantsTimeOut) {
+    BlockingQueue queue(1);
+    int value = 0;
+    EXPECT_FALSE(queue.tryPop(value, 5ms));
+
+    EXPECT_TRUE(queue.tryPush(10, 5ms));
+    const auto start = std::chrono::steady_clock::now();
+    EXPECT_FALSE(queue.tryPush(11, 20ms));
+    EXPECT_GE(std::chrono::steady_clock::now() - start, 20ms);
+
+    EXPECT_TRUE(queue.tryPop(value, 5ms));
+    EXPECT_EQ(value, 10);
+}
+
+TEST(BlockingQueueTest, PushBlocksUntilRoom) {
+    BlockingQueue queue(1);
+    queue.push(1);
+    std::atomic<bool> pushed{false};
+
+    std::thread producer([&] {
+        queue.push(2);
+        pushed = true;
+    });
+    std::this_thread::sleep_for(20ms);
+    EXPECT_FALSE(pushed);
+
+    EXPECT_EQ(queue.pop(), 1);
+    producer.join();
+    EXPECT_TRUE(pushed);
+    EXPECT_EQ(queue.pop(), 2);
+}
+
+TEST(BlockingQueueTest, PopBlocksUntilData) {
+    BlockingQueue queue(2);
+    std::atomic<int> received{0};
+
+    std::thread consumer([&] { received = queue.pop(); });
+    std::this_thread::sleep_for(20ms);
+    EXPECT_EQ(received, 0);
+
+    queue.push(42);
+    consumer.join();
+    EXPECT_EQ(received, 42);
+}
+
+TEST(BlockingQueueTest, CloseWakesWaitersAndDrains) {
+    BlockingQueue queue(2);
+    std::thread consumer([&] { EXPECT_EQ(queue.pop(), INT_MIN); });
+    std::this_thread::sleep_for(10ms);
+    queue.close();
+    consumer.join();
+
+    EXPECT_TRUE(queue.isClosed());
+    EXPECT_FALSE(queue.push(1));
+    EXPECT_FALSE(queue.tryPush(1, 0ms));
+
+    BlockingQueue pending(4);
+    pending.push(1);
+    pending.push(2);
+    pending.close();
+    EXPECT_EQ(pending.pop(), 1); // what was queued before close() is still delivered
+    std::vector<int> out;
+    EXPECT_EQ(pending.popBatch(out, 10), 1);
+    EXPECT_EQ(out, std::vector<int>({2}));
+    EXPECT_EQ(pending.popBatch(out, 10), 0);
+    EXPECT_EQ(pending.pop(), INT_MIN);
+}
+
+TEST(BlockingQueueTest, CloseReleasesBlockedProducer) {
+    BlockingQueue queue(1);
+    queue.push(1);
+    std::thread producer([&] { EXPECT_FALSE(queue.push(2)); });
+    std::this_thread::sleep_for(10ms);
+    queue.close();
+    producer.join();
+}
+
+TEST(BlockingQueueTest, BatchesMoveManyElementsPerCall) {
+    BlockingQueue queue(8);
+    EXPECT_EQ(queue.pushBatch({1, 2, 3, 4, 5}), 5);
+
+    std::vector<int> out;
+    EXPECT_EQ(queue.popBatch(out, 3), 3);
+    EXPECT_EQ(out, std::vector<int>({1, 2, 3}));
+    EXPECT_EQ(queue.tryPopBatch(out, 10, 0ms), 2);
+    EXPECT_EQ(out, std::vector<int>({1, 2, 3, 4, 5}));
+    EXPECT_EQ(queue.tryPopBatch(out, 10, 5ms), 0);
+    EXPECT_EQ(queue.popBatch(out, 0), 0);
+}
+
+TEST(BlockingQueueTest, PushBatchLargerThanCapacity) {
+    BlockingQueue queue(4);
+    std::vector<int> values(100);
+    std::iota(values.begin(), values.end(), 0);
+
+    std::vector<int> received;
+    std::thread consumer([&] {
+        while (received.size() < values.size()) {
+            queue.popBatch(received, 16);
+        }
+    });
+    EXPECT_EQ(queue.pushBatch(values), 100);
+    consumer.join();
+    EXPECT_EQ(received, values);
+}
+
+TEST(BlockingQueueTest, ManyProducersManyConsumers) {
+    constexpr int kProducers = 4;
+    constexpr int kConsumers = 3;
+    constexpr int kPerProducer = 5000;
+    BlockingQueue queue(64);
+
+    std::atomic<long long> sum{0};
+    std::atomic<int> count{0};
+    std::vector<std::thread> threads;
+
+    for (int c = 0; c < kConsumers; ++c) {
+        threads.emplace_back([&, c] {
+            std::vector<int> batch;
+            while (true) {
+                batch.clear();
+                // mix single pops and batch pops
+                const int taken = c % 2 == 0 ? queue.popBatch(batch, 32)
+                                             : (queue.pop() == INT_MIN ? 0 : 1);
+                if (taken == 0)
+                    break;
+                for (const int v : batch) {
+                    sum += v;
+                }
+                if (batch.empty())
+                    sum += 1;
+                count += taken;
+            }
+        });
+    }
+
+    std::vector<std::thread> producers;
+    for (int p = 0; p < kProducers; ++p) {
+        producers.emplace_back([&, p] {
+            if (p % 2 == 0) {
+                for (int i = 0; i < kPerProducer; ++i) {
+                    queue.push(1);
+                }
+            } else {
+                queue.pushBatch(std::vector<int>(kPerProducer, 1));
+            }
+        });
+    }
+    for (auto& t : producers) {
+        t.join();
+    }
+    queue.close();
+    for (auto& t : threads) {
+        t.join();
+    }
+
+    EXPECT_EQ(count, kProducers * kPerProducer);
+    EXPECT_EQ(sum, kProducers * kPerProducer);
+}
@@ -0,0 +1,151 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <climits>
+#include <thread>
+#include <vector>
+#include "concurrentdoublylinkedlist.hpp"
+
+TEST(ConcurrentDoublyLinkedListTest, EmptyList) {
+    ConcurrentDoublyLinkedList list;
+    EXPECT_EQ(list.getLength(), 0);
+    EXPECT_EQ(list.get(0), INT_MIN);
+    EXPECT_FALSE(list.deleteFirst());
+    EXPECT_FALSE(list.deleteLast());
+    EXPECT_FALSE(list.set(0, 1));
+    EXPECT_FALSE(list.insertNode(1, 1));
+    EXPECT_TRUE(list.toVector().empty());
+    EXPECT_TRUE(list.isConsistent());
+}
+
+TEST(ConcurrentDoublyLinkedListTest, SequentialBehaviourMatchesDoublyLinkedList) {
+    ConcurrentDoublyLinkedList list(2);
+    list.append(3);
+    list.prepend(1);
+    EXPECT_TRUE(list.insertNode(3, 4)); // at the end
+    EXPECT_TRUE(list.insertNode(1, 9));
+    EXPECT_FALSE(list.insertNode(6, 0));
+    EXPECT_FALSE(list.insertNode(-1, 0));
+    EXPECT_EQ(list.toVector(), (std::vector<int>{1, 9, 2, 3, 4}));
+
+    EXPECT_EQ(list.get(1), 9);
+    EXPECT_EQ(list.get(5), INT_MIN);
+    EXPECT_TRUE(list.set(4, 40));
+    EXPECT_TRUE(list.deleteNode(1));
+    EXPECT_FALSE(list.deleteNode(4));
+    EXPECT_TRUE(list.deleteFirst());
+    EXPECT_TRUE(list.deleteLast());
+    EXPECT_EQ(list.toVector(), (std::vector<int>{2, 3}));
+    EXPECT_EQ(list.getLength(), 2);
+    EXPECT_TRUE(list.isConsistent());
+
+    EXPECT_TRUE(list.deleteLast());
+    EXPECT_TRUE(list.deleteLast());
+    EXPECT_FALSE(list.deleteLast());
+    list.append(7);
+    EXPECT_EQ(list.toVector(), (std::vector<int>{7}));
+}
+
+TEST(ConcurrentDoublyLinkedListTest, ConcurrentAppendsAndPrepends) {
+    ConcurrentDoublyLinkedList list;
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([&list, t] {
+            for (int i = 0; i < 2000; ++i) {
+                if (t % 2 == 0) {
+                    list.append(i);
+                } else {
+                    list.prepend(-i);
+                }
+            }
+        });
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+    EXPECT_EQ(list.getLength(), 8000);
+    EXPECT_TRUE(list.isConsistent());
+    // prepends and appends never interleave: negatives first
+    const std::vector<int> values = list.toVector();
+    EXPECT_LE(values.front(), 0);
+    EXPECT_GE(values.back(), 0);
+}
+
+TEST(ConcurrentDoublyLinkedListTest, StressMixedEditsStayConsistent) {
+    ConcurrentDoublyLinkedList list;
+    for (int i = 0; i < 256; ++i) {
+        list.append(i);
+    }
+    std::atomic<int> net{0};
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 6; ++t) {
+        threads.emplace_back([&list, &net, t] {
+            unsigned state = 777u + t;
+            for (int i = 0; i < 4000; ++i) {
+                state = state * 1664525u + 1013904223u;
+                const int index = static_cast<int>((state >> 8) % 300);
+                switch ((state >> 24) % 8) {
+                    case 0:
+                        list.append(i);
+                        net.fetch_add(1);
+                        break;
+                    case 1:
+                        net.fetch_sub(list.deleteLast() ? 1 : 0);
+                        break;
+                    case 2:
+                        list.prepend(i);
+                        net.fetch_add(1);
+                        break;
+                    case 3:
+                        net.fetch_sub(list.deleteFirst() ? 1 : 0);
+                        break;
+                    case 4:
+                        net.fetch_add(list.insertNode(index, i) ? 1 : 0);
+                        break;
+                    case 5:
+                        net.fetch_sub(list.deleteNode(index) ? 1 : 0);
+                        break;
+                    case 6:
+                        list.set(index, i);
+                        break;
+                    default:
+                        list.get(index);
+                }
+            }
+        });
+    }
+    // a concurrent reader always sees a well-formed list
+    std::thread reader([&list] {
+        for (int i = 0; i < 200; ++i) {
+            EXPECT_LE(list.toVector().size(), 256u + 6 * 4000);
+        }
+    });
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+    reader.join();
+    EXPECT_EQ(list.getLength(), 256 + net.load());
+    EXPECT_EQ(static_cast<int>(list.toVector().size()), list.getLength());
+    EXPECT_TRUE(list.isConsistent());
+}
+
+TEST(ConcurrentDoublyLinkedListTest, TailAndHeadEditsDoNotDeadlock) {
+    ConcurrentDoublyLinkedList list;
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([&list, t] {
+            for (int i = 0; i < 3000; ++i) {
+                if (t < 2) {
+                    list.append(i);
+                    list.deleteLast();
+                } else {
+                    list.insertNode(list.getLength() / 2, i); // may race to the end
+                    list.deleteFirst();
+                }
+            }
+        });
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+    EXPECT_TRUE(list.isConsistent());
+}
@@ -0,0 +1,161 @@
+#include "containerstats.hpp"
+#include "doublylinkedlist.hpp"
+#include "linkedlist.hpp"
+#include "queue.hpp"
+#include "stack.hpp"
+#include <gtest/gtest.h>
+
+// These tests run in both configurations: with ENABLE_CONTAINER_STATS=OFF
+// every counter must stay at zero, with it ON the counters must be exact.
+
+// ------ Zero-cost when disabled ------
+
+TEST(ContainerStatsTest, DisabledStatsAddNoBytes) {
+    if (ContainerStats::enabled) {
+        GTEST_SKIP() << "counters are compiled in";
+    }
+    // head, tail, length and the memory resource (LinkedList's arena flag
+    // fits in the padding after length)
+    struct ListFields {
+        void* head;
+        void* tail;
+        int length;
+        void* resource;
+    };
+    // LinkedList also keeps a pointer to its (lazily created) defragment state
+    struct LinkedListFields {
+        ListFields list;
+        void* defrag;
+    };
+    EXPECT_EQ(sizeof(LinkedList), sizeof(LinkedListFields));
+    EXPECT_EQ(sizeof(DoublyLinkedList), sizeof(ListFields));
+
+    LinkedList ll(1);
+    ll.append(2);
+    const StatsSnapshot snapshot = ll.getStats();
+    EXPECT_EQ(snapshot.inserts, 0u);
+    EXPECT_EQ(snapshot.allocations, 0u);
+}
+
+// ------ LinkedList ------
+
+TEST(ContainerStatsTest, LinkedList_CountsOperationsAndTraversal) {
+    if (!ContainerStats::enabled) {
+        GTEST_SKIP() << "build with -DENABLE_CONTAINER_STATS=ON";
+    }
+    LinkedList ll(1);
+    ll.append(2);
+    ll.append(3);
+    ll.prepend(0); // 0 1 2 3
+    ll.get(3);     // 3 hops
+    ll.deleteLast(); // walks 3 nodes to find the new tail
+    ll.deleteFirst();
+    ll.deleteFirst();
+    ll.deleteFirst();
+    ll.deleteFirst(); // empty
+
+    const StatsSnapshot s = ll.getStats();
+    EXPECT_EQ(s.inserts, 4u);
+    EXPECT_EQ(s.removals, 4u);
+    EXPECT_EQ(s.emptyRemovals, 1u);
+    EXPECT_EQ(s.lookups, 1u);
+    EXPECT_EQ(s.nodesTraversed, 6u);
+    EXPECT_EQ(s.allocations, 4u);
+    EXPECT_EQ(s.deallocations, 4u);
+    EXPECT_EQ(s.bytesAllocated, 4u * sizeof(Node));
+    EXPECT_EQ(s.bytesFreed, s.bytesAllocated);
+    EXPECT_EQ(s.highWaterMark, 4u);
+}
+
+TEST(ContainerStatsTest, LinkedList_ResetStats) {
+    if (!ContainerStats::enabled) {
+        GTEST_SKIP() << "build with -DENABLE_CONTAINER_STATS=ON";
+    }
+    LinkedList ll(1);
+    ll.resetStats();
+    EXPECT_EQ(ll.getStats().inserts, 0u);
+    ll.append(2);
+    EXPECT_EQ(ll.getStats().inserts, 1u);
+}
+
+// ------ DoublyLinkedList ------
+
+TEST(ContainerStatsTest, DoublyLinkedList_GetWalksFromNearestEnd) {
+    if (!ContainerStats::enabled) {
+        GTEST_SKIP() << "build with -DENABLE_CONTAINER_STATS=ON";
+    }
+    DoublyLinkedList dll(0);
+    for (int i = 1; i < 10; ++i) {
+        dll.append(i);
+    }
+    dll.get(1); // 1 hop from head
+    dll.get(8); // 1 hop from tail
+    const StatsSnapshot s = dll.getStats();
+    EXPECT_EQ(s.lookups, 2u);
+    EXPECT_EQ(s.nodesTraversed, 2u);
+    EXPECT_EQ(s.highWaterMark, 10u);
+    EXPECT_EQ(s.bytesAllocated, 10u * sizeof(DNode));
+}
+
+// ------ Stack / Queue ------
+
+TEST(ContainerStatsTest, Stack_CountsPopOnEmpty) {
+    if (!ContainerStats::enabled) {
+        GTEST_SKIP() << "build with -DENABLE_CONTAINER_STATS=ON";
+    }
+    Stack stack(1);
+    stack.push(2);
+    stack.pop();
+    stack.pop();
+    stack.pop();
+    const StatsSnapshot s = stack.getStats();
+    EXPECT_EQ(s.inserts, 2u);
+    EXPECT_EQ(s.removals, 2u);
+    EXPECT_EQ(s.emptyRemovals, 1u);
+    EXPECT_EQ(s.highWaterMark, 2u);
+}
+
+TEST(ContainerStatsTest, Queue_CountsDeQueueOnEmpty) {
+    if (!ContainerStats::enabled) {
+        GTEST_SKIP() << "build with -DENABLE_CONTAINER_STATS=ON";
+    }
+    Queue queue(1);
+    for (int i = 0; i < 5; ++i) {
+        queue.enQueue(i);
+    }
+    queue.clear();
+    queue.deQueue();
+    const StatsSnapshot s = queue.getStats();
+    EXPECT_EQ(s.inserts, 6u);
+    EXPECT_EQ(s.deallocations, 6u);
+    EXPECT_EQ(s.emptyRemovals, 1u);
+    EXPECT_EQ(s.highWaterMark, 6u);
+}
+
+TEST(ContainerStatsTest, EmptyConstructorsRecordNothing) {
+    if (!ContainerStats::enabled) {
+        GTEST_SKIP() << "build with -DENABLE_CONTAINER_STATS=ON";
+    }
+    Queue queue;
+    Stack stack;
+    EXPECT_EQ(queue.getStats().inserts, 0u);
+    EXPECT_EQ(queue.getStats().allocations, 0u);
+    EXPECT_EQ(stack.getStats().inserts, 0u);
+    queue.enQueue(1);
+    EXPECT_EQ(queue.getStats().inserts, 1u);
+    EXPECT_EQ(queue.getStats().highWaterMark, 1u);
+}
+
+// ------ Dumps ------
+
+TEST(ContainerStatsTest, SnapshotDumps) {
+    StatsSnapshot s;
+    s.inserts = 3;
+    s.highWaterMark = 2;
+    EXPECT_NE(s.toText().find("inserts:         3\n"), std::string::npos);
+    EXPECT_EQ(
+        s.toJson(),
+        "{\"inserts\":3,\"removals\":0,\"lookups\":0,\"nodesTraversed\":0,"
+        "\"allocations\":0,\"deallocations\":0,\"bytesAllocated\":0,"
+        "\"bytesFreed\":0,\"emptyRemovals\":0,\"highWaterMark\":2}");
+}
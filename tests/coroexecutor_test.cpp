@@ -0,0 +1,64 @@
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "coroexecutor.hpp"
+
+namespace {
+CoroTask record(std::vector<std::string>& log, const std::string name) {
+    log.push_back(name);
+    co_return;
+}
+
+CoroTask takeTurns(CoroExecutor& executor, std::vector<std::string>& log,
+                   const std::string name, const int turns) {
+    for (int i = 0; i < turns; ++i) {
+        log.push_back(name + std::to_string(i));
+        co_await executor.yield();
+    }
+}
+
+CoroTask fail() {
+    throw std::runtime_error("task failed");
+    co_return;
+}
+} // namespace
+
+TEST(CoroExecutorTest, SpawnedTaskRunsOnlyInRun) {
+    CoroExecutor executor;
+    std::vector<std::string> log;
+    executor.spawn(record(log, "a"));
+    EXPECT_TRUE(log.empty());
+    EXPECT_EQ(executor.getTaskCount(), 1);
+    EXPECT_EQ(executor.getReadyCount(), 1);
+
+    EXPECT_EQ(executor.run(), 1);
+    EXPECT_EQ(log, (std::vector<std::string>{"a"}));
+    EXPECT_EQ(executor.getTaskCount(), 0);
+}
+
+TEST(CoroExecutorTest, YieldInterleavesInFifoOrder) {
+    CoroExecutor executor;
+    std::vector<std::string> log;
+    executor.spawn(takeTurns(executor, log, "a", 2));
+    executor.spawn(takeTurns(executor, log, "b", 2));
+    EXPECT_EQ(executor.run(), 6);
+    EXPECT_EQ(log, (std::vector<std::string>{"a0", "b0", "a1", "b1"}));
+}
+
+TEST(CoroExecutorTest, UnspawnedTaskNeverRuns) {
+    std::vector<std::string> log;
+    {
+        CoroTask task = record(log, "a");
+        CoroTask moved = std::move(task);
+    }
+    EXPECT_TRUE(log.empty());
+}
+
+TEST(CoroExecutorTest, RunRethrowsTaskException) {
+    CoroExecutor executor;
+    executor.spawn(fail());
+    EXPECT_THROW(executor.run(), std::runtime_error);
+    EXPECT_EQ(executor.getTaskCount(), 0);
+    EXPECT_EQ(executor.run(), 0);
+}
@@ -0,0 +1,198 @@
+#include <gtest/gtest.h>
+#include <array>
+#include <cstddef>
+#include <memory_resource>
+#include <sstream>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include "cowlinkedlist.hpp"
+
+namespace {
+std::string toString(const CowLinkedList& list) {
+    std::ostringstream out;
+    out << list;
+    return out.str();
+}
+
+CowLinkedList makeList(const int n) {
+    CowLinkedList list(0);
+    for (int i = 1; i < n; ++i) {
+        list.append(i);
+    }
+    return list;
+}
+} // namespace
+
+TEST(CowLinkedListTest, CopiesShareNodesUntilWritten) {
+    CowLinkedList original = makeList(5);
+    const CowLinkedList copy = original;
+    EXPECT_TRUE(original.isShared());
+    EXPECT_EQ(copy.getShareCount(), 2);
+    EXPECT_EQ(copy.getHead(), original.getHead()); // no node was copied
+
+    original.set(2, 42);
+    EXPECT_FALSE(original.isShared());
+    EXPECT_FALSE(copy.isShared());
+    EXPECT_NE(copy.getHead(), original.getHead());
+    EXPECT_EQ(toString(original), "{0, 1, 42, 3, 4}");
+    EXPECT_EQ(toString(copy), "{0, 1, 2, 3, 4}");
+}
+
+// Nothing reachable from a const handle may hand out a writable node or list
+template <typename Handle>
+concept ExposesMutableNodes = requires(const Handle& handle) {
+    { handle.getHead()->setData(0) };
+} || requires(const Handle& handle) { handle.view(); };
+
+TEST(CowLinkedListTest, SharedCopyCannotBeWrittenThroughReads) {
+    static_assert(!ExposesMutableNodes<CowLinkedList>);
+    static_assert(std::is_same_v<decltype(std::declval<const CowLinkedList&>().get(0)), const Node*>);
+    static_assert(std::is_same_v<decltype(std::declval<const CowLinkedList&>().getTail()), const Node*>);
+    static_assert(std::is_same_v<decltype(std::declval<const CowLinkedList&>().findMiddleNode()),
+                                 const Node*>);
+
+    CowLinkedList original = makeList(3);
+    const CowLinkedList copy = original;
+    // the only writable way in detaches first, so the copy keeps its nodes
+    original.mutableList().get(1)->setData(42);
+    EXPECT_FALSE(copy.isShared());
+    EXPECT_EQ(toString(copy), "{0, 1, 2}");
+    EXPECT_EQ(toString(original), "{0, 42, 2}");
+}
+
+TEST(CowLinkedListTest, UnsharedListMutatesInPlace) {
+    CowLinkedList list = makeList(3);
+    const Node* head = list.getHead();
+    list.set(0, 7);
+    list.append(3);
+    EXPECT_EQ(list.getHead(), head);
+    EXPECT_EQ(list.getHead()->getData(), 7);
+    EXPECT_EQ(list.getLength(), 4);
+}
+
+TEST(CowLinkedListTest, EveryMutatorDetaches) {
+    const CowLinkedList source = makeList(6);
+    const std::string before = toString(source);
+
+    const auto mutateCopy = [&source](auto mutation) {
+        CowLinkedList copy = source;
+        mutation(copy);
+        EXPECT_FALSE(copy.isShared());
+        return toString(copy);
+    };
+    EXPECT_EQ(mutateCopy([](CowLinkedList& l) { l.append(6); }), "{0, 1, 2, 3, 4, 5, 6}");
+    EXPECT_EQ(mutateCopy([](CowLinkedList& l) { l.prepend(-1); }), "{-1, 0, 1, 2, 3, 4, 5}");
+    EXPECT_EQ(mutateCopy([](CowLinkedList& l) { l.deleteLast(); }), "{0, 1, 2, 3, 4}");
+    EXPECT_EQ(mutateCopy([](CowLinkedList& l) { l.deleteFirst(); }), "{1, 2, 3, 4, 5}");
+    EXPECT_EQ(mutateCopy([](CowLinkedList& l) { l.deleteNode(2); }), "{0, 1, 3, 4, 5}");
+    EXPECT_EQ(mutateCopy([](CowLinkedList& l) { l.insert(1, 9); }), "{0, 9, 1, 2, 3, 4, 5}");
+    EXPECT_EQ(mutateCopy([](CowLinkedList& l) { l.reverse(); }), "{5, 4, 3, 2, 1, 0}");
+    EXPECT_EQ(mutateCopy([](CowLinkedList& l) { l.reverseBetween(1, 3); }), "{0, 3, 2, 1, 4, 5}");
+    EXPECT_EQ(mutateCopy([](CowLinkedList& l) { l.swapPairs(); }), "{1, 0, 3, 2, 5, 4}");
+    EXPECT_EQ(mutateCopy([](CowLinkedList& l) { l.partitionList(3); }), "{0, 1, 2, 3, 4, 5}");
+    EXPECT_EQ(mutateCopy([](CowLinkedList& l) { l.mutableList().defragment(); }), before);
+    EXPECT_EQ(toString(source), before);
+    EXPECT_EQ(source.getShareCount(), 1);
+}
+
+TEST(CowLinkedListTest, NoOpCallsDoNotCopy) {
+    const CowLinkedList source = makeList(3);
+    CowLinkedList copy = source;
+    EXPECT_FALSE(copy.set(3, 1));
+    EXPECT_FALSE(copy.insert(-1, 1));
+    copy.deleteNode(10);
+    EXPECT_TRUE(copy.isShared());
+
+    CowLinkedList single(1);
+    CowLinkedList singleCopy = single;
+    singleCopy.reverse();
+    singleCopy.swapPairs();
+    EXPECT_TRUE(singleCopy.isShared());
+}
+
+TEST(CowLinkedListTest, ClearOnSharedListDropsTheReference) {
+    const CowLinkedList source = makeList(4);
+    CowLinkedList copy = source;
+    copy.clear();
+    EXPECT_EQ(copy.getLength(), 0);
+    EXPECT_EQ(copy.getHead(), nullptr);
+    EXPECT_EQ(source.getLength(), 4);
+    EXPECT_FALSE(source.isShared());
+
+    copy.append(1);
+    EXPECT_EQ(toString(copy), "{1}");
+}
+
+TEST(CowLinkedListTest, ReadOnlyQueries) {
+    const CowLinkedList list = makeList(5);
+    EXPECT_EQ(list.get(3)->getData(), 3);
+    EXPECT_EQ(list.get(5), nullptr);
+    EXPECT_EQ(list.findMiddleNode()->getData(), 2);
+    EXPECT_EQ(list.findKthFromEnd(1)->getData(), 4);
+    EXPECT_EQ(list.getTail()->getData(), 4);
+    EXPECT_FALSE(list.hasLoop());
+
+    CowLinkedList bits(1);
+    bits.append(0);
+    bits.append(1);
+    EXPECT_EQ(bits.binaryToDecimal(), 5);
+}
+
+TEST(CowLinkedListTest, AdoptsALinkedListWithoutCopying) {
+    LinkedList plain(1);
+    plain.append(2);
+    const Node* head = plain.getHead();
+    const CowLinkedList list(std::move(plain));
+    EXPECT_EQ(list.getHead(), head);
+    EXPECT_EQ(list.getLength(), 2);
+}
+
+TEST(CowLinkedListTest, MovedFromHandleStaysUsable) {
+    CowLinkedList list = makeList(2);
+    const CowLinkedList moved(std::move(list));
+    EXPECT_EQ(moved.getLength(), 2);
+    list.append(5); // NOLINT(bugprone-use-after-move)
+    EXPECT_EQ(toString(list), "{0, 1, 5}");
+    EXPECT_EQ(toString(moved), "{0, 1}");
+}
+
+TEST(CowLinkedListTest, PrivateCopyStaysOnTheResource) {
+    alignas(std::max_align_t) std::array<std::byte, 4096> buffer{};
+    std::pmr::monotonic_buffer_resource arena(buffer.data(), buffer.size());
+
+    CowLinkedList list(1, &arena);
+    list.append(2);
+    CowLinkedList copy = list;
+    copy.append(3);
+    EXPECT_EQ(copy.getResource(), &arena);
+    const auto* node = reinterpret_cast<const std::byte*>(copy.getTail());
+    EXPECT_GE(node, buffer.data());
+    EXPECT_LT(node, buffer.data() + buffer.size());
+    EXPECT_EQ(toString(list), "{1, 2}");
+}
+
+TEST(CowLinkedListTest, ReaderDropsWhileAnotherHandleWrites) {
+    // run under ENABLE_TSAN: a writer that finds itself the last handle must
+    // not race with the reads the other handle did before letting go
+    for (int round = 0; round < 200; ++round) {
+        auto* reader = new CowLinkedList(makeList(64));
+        CowLinkedList writer = *reader;
+
+        long long sum = 0;
+        std::thread readerThread([reader, &sum] {
+            for (const Node* node = reader->getHead(); node != nullptr; node = node->getNext()) {
+                sum += node->getData();
+            }
+            delete reader;
+        });
+        for (int i = 0; i < 64; ++i) {
+            writer.set(i, -1);
+        }
+        readerThread.join();
+
+        EXPECT_EQ(sum, 63LL * 64 / 2);
+        EXPECT_FALSE(writer.isShared());
+        EXPECT_EQ(writer.get(63)->getData(), -1);
+    }
+}
@@ -0,0 +1,191 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+#include "daryheap.hpp"
+
+namespace {
+
+template <typename Heap>
+std::vector<int> drain(Heap& heap) {
+    std::vector<int> out;
+    while (auto value = heap.pop()) {
+        out.push_back(*value);
+    }
+    return out;
+}
+
+} // namespace
+
+TEST(DaryHeapTest, EmptyHeap) {
+    DaryHeap<int> heap;
+    EXPECT_TRUE(heap.empty());
+    EXPECT_EQ(heap.getSize(), 0u);
+    EXPECT_EQ(heap.peek(), nullptr);
+    EXPECT_FALSE(heap.pop().has_value());
+}
+
+TEST(DaryHeapTest, PushPopInPriorityOrder) {
+    DaryHeap<int> heap;
+    for (const int v : {5, 3, 8, 1, 9, 2, 7}) {
+        heap.push(v);
+    }
+    EXPECT_EQ(heap.getSize(), 7u);
+    ASSERT_NE(heap.peek(), nullptr);
+    EXPECT_EQ(*heap.peek(), 1);
+    EXPECT_EQ(drain(heap), std::vector<int>({1, 2, 3, 5, 7, 8, 9}));
+    EXPECT_TRUE(heap.empty());
+}
+
+TEST(DaryHeapTest, MaxHeapWithGreater) {
+    DaryHeap<int, 3, std::greater<int>> heap;
+    for (const int v : {4, 10, 1, 10, 6}) {
+        heap.push(v);
+    }
+    EXPECT_EQ(drain(heap), std::vector<int>({10, 10, 6, 4, 1}));
+}
+
+TEST(DaryHeapTest, BinaryAndWideAritiesAgree) {
+    std::mt19937 rng(7);
+    std::vector<int> values(1000);
+    for (int& v : values) {
+        v = static_cast<int>(rng() % 500);
+    }
+    std::vector<int> sorted = values;
+    std::sort(sorted.begin(), sorted.end());
+
+    DaryHeap<int, 2> binary;
+    DaryHeap<int, 8> wide;
+    for (const int v : values) {
+        binary.push(v);
+        wide.push(v);
+    }
+    EXPECT_EQ(drain(binary), sorted);
+    EXPECT_EQ(drain(wide), sorted);
+}
+
+TEST(DaryHeapTest, HeapifyFromRange) {
+    const std::vector<int> values = {9, 4, 7, 1, 8, 2, 6, 3, 5, 0};
+    DaryHeap<int> heap(values.begin(), values.end());
+    EXPECT_EQ(heap.getSize(), values.size());
+
+    // every node is no larger than its children
+    const auto& data = heap.data();
+    for (std::size_t i = 1; i < data.size(); ++i) {
+        EXPECT_LE(data[(i - 1) / 4], data[i]) << i;
+    }
+    EXPECT_EQ(drain(heap), std::vector<int>({0, 1, 2, 3, 4, 5, 6, 7, 8, 9}));
+
+    heap.assign(values.begin(), values.begin() + 1);
+    EXPECT_EQ(*heap.peek(), 9);
+    heap.clear();
+    EXPECT_TRUE(heap.empty());
+}
+
+TEST(DaryHeapTest, HoldsNonTrivialValues) {
+    DaryHeap<std::string> heap;
+    heap.push("pear");
+    heap.push("apple");
+    heap.push("fig");
+    EXPECT_EQ(*heap.pop(), "apple");
+    EXPECT_EQ(*heap.pop(), "fig");
+    EXPECT_EQ(*heap.pop(), "pear");
+}
+
+TEST(AddressableDaryHeapTest, PushPopAndHandles) {
+    AddressableDaryHeap<int> heap;
+    const auto a = heap.push(30);
+    const auto b = heap.push(10);
+    const auto c = heap.push(20);
+
+    EXPECT_EQ(heap.getSize(), 3u);
+    EXPECT_EQ(heap.topHandle(), b);
+    EXPECT_EQ(*heap.get(a), 30);
+    EXPECT_EQ(*heap.pop(), 10);
+    EXPECT_FALSE(heap.contains(b));
+    EXPECT_EQ(heap.get(b), nullptr);
+    EXPECT_TRUE(heap.contains(a));
+    EXPECT_TRUE(heap.contains(c));
+    EXPECT_FALSE(heap.contains(AddressableDaryHeap<int>::kInvalidHandle));
+}
+
+TEST(AddressableDaryHeapTest, DecreaseKeyMovesToTop) {
+    AddressableDaryHeap<int> heap;
+    std::vector<AddressableDaryHeap<int>::Handle> handles;
+    for (int v = 100; v < 120; ++v) {
+        handles.push_back(heap.push(v));
+    }
+    EXPECT_TRUE(heap.decreaseKey(handles[15], 5));
+    EXPECT_EQ(heap.topHandle(), handles[15]);
+    EXPECT_EQ(*heap.peek(), 5);
+
+    // increasing through decreaseKey is refused
+    EXPECT_FALSE(heap.decreaseKey(handles[3], 200));
+    EXPECT_EQ(*heap.get(handles[3]), 103);
+
+    EXPECT_TRUE(heap.update(handles[15], 500));
+    EXPECT_EQ(*heap.peek(), 100);
+}
+
+TEST(AddressableDaryHeapTest, EraseAndHandleReuse) {
+    AddressableDaryHeap<int> heap;
+    const auto a = heap.push(1);
+    const auto b = heap.push(2);
+    const auto c = heap.push(3);
+
+    EXPECT_TRUE(heap.erase(b));
+    EXPECT_FALSE(heap.erase(b));
+    EXPECT_FALSE(heap.update(b, 0));
+
+    const auto d = heap.push(0); // reuses b's slot
+    EXPECT_EQ(d, b);
+    EXPECT_EQ(heap.topHandle(), d);
+    EXPECT_TRUE(heap.erase(a));
+    EXPECT_EQ(drain(heap), std::vector<int>({0, 3}));
+    EXPECT_FALSE(heap.contains(c));
+
+    heap.push(4);
+    heap.clear();
+    EXPECT_TRUE(heap.empty());
+    EXPECT_EQ(heap.push(9), 0u);
+}
+
+TEST(AddressableDaryHeapTest, RandomOperationsMatchModel) {
+    using Heap = AddressableDaryHeap<int>;
+    Heap heap;
+    std::map<Heap::Handle, int> live;
+    std::mt19937 rng(123);
+
+    for (int step = 0; step < 20000; ++step) {
+        const unsigned op = rng() % 5;
+        if (op <= 1 || live.empty()) {
+            const int v = static_cast<int>(rng() % 10000);
+            live[heap.push(v)] = v;
+        } else if (op == 2) {
+            auto it = live.begin();
+            std::advance(it, rng() % live.size());
+            const int v = static_cast<int>(rng() % 10000);
+            heap.update(it->first, v);
+            it->second = v;
+        } else if (op == 3) {
+            auto it = live.begin();
+            std::advance(it, rng() % live.size());
+            ASSERT_TRUE(heap.erase(it->first));
+            live.erase(it);
+        } else {
+            int smallest = live.begin()->second;
+            for (const auto& [handle, v] : live) {
+                smallest = std::min(smallest, v);
+            }
+            const Heap::Handle top = heap.topHandle();
+            ASSERT_EQ(live.at(top), smallest);
+            ASSERT_EQ(*heap.pop(), smallest);
+            live.erase(top);
+        }
+        ASSERT_EQ(heap.getSize(), live.size());
+    }
+}
@@ -72,6 +72,19 @@ protected:
     }
 };
 
+// ------ Constructor ------
+TEST(DoublyLinkedListConstructorTest, DefaultConstructedListIsEmpty) {
+    DoublyLinkedList list;
+    EXPECT_EQ(list.getLength(), 0);
+    EXPECT_EQ(list.getHead(), nullptr);
+    EXPECT_EQ(list.getTail(), nullptr);
+    EXPECT_EQ(list.getResource(), nullptr);
+
+    list.append(5);
+    EXPECT_EQ(list.getLength(), 1);
+    EXPECT_EQ(list.getHead(), list.getTail());
+}
+
 // ------ Display ------ 
 
 TEST_F(EmptyDoublyLinkedListTest, Display_OutputsEmptyListFormat) {
@@ -309,4 +322,90 @@ TEST_F(MultiNodeDoublyLinkedListTest, DeleteNode_FromMultiNodeDLL) {
     EXPECT_EQ(dll->getLength(), 0);
     EXPECT_EQ(dll->getHead(), nullptr);
     EXPECT_EQ(dll->getTail(), nullptr);
-}
\ No newline at end of file
+}
+
+// ------- Node-handle APIs -------
+
+TEST_F(MultiNodeDoublyLinkedListTest, EraseAt_MiddleHeadAndTail) {
+    DNode* middle = dll->get(1);
+    dll->eraseAt(middle);
+    EXPECT_EQ(dll->getLength(), 2);
+    EXPECT_EQ(captureDisplay(), "{10, 30}\n");
+
+    dll->eraseAt(dll->getHead());
+    EXPECT_EQ(dll->getHead()->getData(), 30);
+    EXPECT_EQ(dll->getHead()->prev, nullptr);
+
+    dll->eraseAt(dll->getTail());
+    EXPECT_EQ(dll->getLength(), 0);
+    EXPECT_EQ(dll->getHead(), nullptr);
+    EXPECT_EQ(dll->getTail(), nullptr);
+}
+
+TEST_F(MultiNodeDoublyLinkedListTest, EraseAt_NullIsNoOp) {
+    dll->eraseAt(nullptr);
+    EXPECT_EQ(dll->getLength(), 3);
+}
+
+TEST_F(MultiNodeDoublyLinkedListTest, InsertBefore_HeadAndMiddle) {
+    DNode* first = dll->insertBefore(dll->getHead(), 5);
+    ASSERT_NE(first, nullptr);
+    EXPECT_EQ(dll->getHead(), first);
+    EXPECT_EQ(first->prev, nullptr);
+
+    DNode* middle = dll->insertBefore(dll->get(3), 25);
+    EXPECT_EQ(middle->getData(), 25);
+    EXPECT_EQ(dll->getLength(), 5);
+    EXPECT_EQ(captureDisplay(), "{5, 10, 20, 25, 30}\n");
+    EXPECT_EQ(middle->prev->getData(), 20);
+    EXPECT_EQ(middle->next->getData(), 30);
+}
+
+TEST_F(MultiNodeDoublyLinkedListTest, InsertAfter_TailAndMiddle) {
+    DNode* last = dll->insertAfter(dll->getTail(), 40);
+    EXPECT_EQ(dll->getTail(), last);
+    EXPECT_EQ(last->next, nullptr);
+
+    dll->insertAfter(dll->getHead(), 15);
+    EXPECT_EQ(dll->getLength(), 5);
+    EXPECT_EQ(captureDisplay(), "{10, 15, 20, 30, 40}\n");
+    EXPECT_EQ(dll->insertAfter(nullptr, 1), nullptr);
+}
+
+TEST_F(MultiNodeDoublyLinkedListTest, InsertAfter_ReturnedHandleStaysValid) {
+    DNode* handle = dll->insertAfter(dll->getHead(), 15);
+    dll->insertAfter(handle, 16);
+    dll->insertBefore(handle, 14);
+    EXPECT_EQ(captureDisplay(), "{10, 14, 15, 16, 20, 30}\n");
+    dll->eraseAt(handle);
+    EXPECT_EQ(captureDisplay(), "{10, 14, 16, 20, 30}\n");
+}
+
+TEST_F(MultiNodeDoublyLinkedListTest, MoveToFront_FromTailAndMiddle) {
+    dll->moveToFront(dll->getTail());
+    EXPECT_EQ(captureDisplay(), "{30, 10, 20}\n");
+    EXPECT_EQ(dll->getTail()->getData(), 20);
+    EXPECT_EQ(dll->getTail()->next, nullptr);
+
+    dll->moveToFront(dll->get(1));
+    EXPECT_EQ(captureDisplay(), "{10, 30, 20}\n");
+    EXPECT_EQ(dll->getHead()->prev, nullptr);
+    EXPECT_EQ(dll->getLength(), 3);
+}
+
+TEST_F(MultiNodeDoublyLinkedListTest, MoveToBack_FromHeadAndMiddle) {
+    dll->moveToBack(dll->getHead());
+    EXPECT_EQ(captureDisplay(), "{20, 30, 10}\n");
+    EXPECT_EQ(dll->getHead()->prev, nullptr);
+
+    dll->moveToBack(dll->get(1));
+    EXPECT_EQ(captureDisplay(), "{20, 10, 30}\n");
+    EXPECT_EQ(dll->getTail()->prev->getData(), 10);
+}
+
+TEST_F(SingleNodeDoublyLinkedListTest, MoveToFrontAndBack_SingleNodeIsNoOp) {
+    dll->moveToFront(dll->getHead());
+    dll->moveToBack(dll->getHead());
+    EXPECT_EQ(dll->getHead(), dll->getTail());
+    EXPECT_EQ(dll->getLength(), 1);
+}
@@ -0,0 +1,170 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include "epoch.hpp"
+
+namespace {
+// Counts live instances so tests can see exactly when retired objects die
+struct Tracked {
+    static inline std::atomic<int> live{0};
+    Tracked() {
+        live.fetch_add(1);
+    }
+    ~Tracked() {
+        live.fetch_sub(1);
+    }
+};
+
+class EpochDomainTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        Tracked::live.store(0);
+    }
+};
+} // namespace
+
+TEST_F(EpochDomainTest, RetiredObjectIsFreedTwoEpochsLater) {
+    EpochDomain domain;
+    domain.retire(new Tracked);
+    EXPECT_EQ(Tracked::live.load(), 1);
+    EXPECT_EQ(domain.getPendingCount(), 1u);
+
+    EXPECT_EQ(domain.collect(), 0u); // epoch 0 -> 1: not yet safe
+    EXPECT_EQ(domain.getEpoch(), 1u);
+    EXPECT_EQ(domain.collect(), 1u); // 1 -> 2: two epochs after the retire
+    EXPECT_EQ(Tracked::live.load(), 0);
+    EXPECT_EQ(domain.getPendingCount(), 0u);
+}
+
+TEST_F(EpochDomainTest, PinnedThreadHoldsBackReclamation) {
+    EpochDomain domain;
+    std::atomic<bool> pinned{false};
+    std::atomic<bool> release{false};
+    std::thread reader([&] {
+        const EpochDomain::Guard guard(domain);
+        pinned.store(true);
+        while (!release.load()) {
+            std::this_thread::yield();
+        }
+    });
+    while (!pinned.load()) {
+        std::this_thread::yield();
+    }
+
+    domain.retire(new Tracked);
+    for (int i = 0; i < 10; ++i) {
+        domain.collect();
+    }
+    // the reader announced the old epoch, so it can advance at most once
+    EXPECT_LE(domain.getEpoch(), 1u);
+    EXPECT_EQ(Tracked::live.load(), 1);
+
+    release.store(true);
+    reader.join();
+    domain.collect();
+    domain.collect();
+    EXPECT_EQ(Tracked::live.load(), 0);
+}
+
+TEST_F(EpochDomainTest, GuardsNest) {
+    EpochDomain domain;
+    {
+        const EpochDomain::Guard outer(domain);
+        {
+            const EpochDomain::Guard inner(domain);
+        }
+        domain.retire(new Tracked);
+        domain.collect();
+        domain.collect();
+        domain.collect();
+        // still pinned by `outer` at the epoch it started in
+        EXPECT_EQ(Tracked::live.load(), 1);
+    }
+    domain.collect();
+    domain.collect();
+    EXPECT_EQ(Tracked::live.load(), 0);
+}
+
+TEST_F(EpochDomainTest, RetireCollectsPeriodically) {
+    EpochDomain domain;
+    for (int i = 0; i < 10 * static_cast<int>(EpochDomain::kCollectInterval); ++i) {
+        domain.retire(new Tracked);
+    }
+    // at most the last couple of intervals are still waiting
+    EXPECT_LE(Tracked::live.load(), 3 * static_cast<int>(EpochDomain::kCollectInterval));
+}
+
+TEST_F(EpochDomainTest, DestructorFreesPendingObjects) {
+    {
+        EpochDomain domain;
+        for (int i = 0; i < 5; ++i) {
+            domain.retire(new Tracked);
+        }
+        std::thread([&domain] { domain.retire(new Tracked); }).join();
+        EXPECT_EQ(domain.getPendingCount(), 6u);
+    }
+    EXPECT_EQ(Tracked::live.load(), 0);
+}
+
+TEST_F(EpochDomainTest, ExitedThreadSlotIsReused) {
+    EpochDomain domain;
+    std::thread([&domain] { domain.retire(new Tracked); }).join();
+    // the next thread adopts the slot and its pending object
+    std::thread([&domain] {
+        domain.collect();
+        domain.collect();
+        domain.collect();
+    }).join();
+    EXPECT_EQ(Tracked::live.load(), 0);
+    EXPECT_EQ(domain.getPendingCount(), 0u);
+}
+
+TEST_F(EpochDomainTest, ConcurrentRetireAndPin) {
+    EpochDomain domain;
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([&domain] {
+            for (int i = 0; i < 5000; ++i) {
+                const EpochDomain::Guard guard(domain);
+                domain.retire(new Tracked);
+            }
+        });
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+    EXPECT_GT(domain.getEpoch(), 0u);
+    EXPECT_LT(Tracked::live.load(), 20000);
+}
+
+TEST_F(EpochDomainTest, AsymmetricPinHoldsBackReclamation) {
+    EpochDomain domain(EpochDomain::PinMode::Asymmetric);
+    // falls back to Fenced where membarrier is unavailable: same guarantees
+    EXPECT_EQ(EpochDomain().getPinMode(), EpochDomain::PinMode::Fenced);
+    std::atomic<bool> pinned{false};
+    std::atomic<bool> release{false};
+    std::thread reader([&] {
+        const EpochDomain::Guard guard(domain);
+        pinned.store(true);
+        while (!release.load()) {
+            std::this_thread::yield();
+        }
+    });
+    while (!pinned.load()) {
+        std::this_thread::yield();
+    }
+
+    domain.retire(new Tracked);
+    for (int i = 0; i < 10; ++i) {
+        domain.collect();
+    }
+    EXPECT_LE(domain.getEpoch(), 1u);
+    EXPECT_EQ(Tracked::live.load(), 1);
+
+    release.store(true);
+    reader.join();
+    domain.collect();
+    domain.collect();
+    EXPECT_EQ(Tracked::live.load(), 0);
+}
@@ -0,0 +1,303 @@
+#include "indexedlinkedlist.hpp"
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <climits>
+#include <random>
+#include <sstream>
+#include <vector>
+
+class IndexedLinkedListTest : public ::testing::Test {
+protected:
+    IndexedLinkedList* ll = nullptr;
+
+    void SetUp() override {
+        ll = new IndexedLinkedList(10);
+        ll->append(20);
+        ll->append(30);
+    }
+
+    void TearDown() override {
+        delete ll;
+    }
+
+    std::string str() const {
+        std::ostringstream out;
+        out << *ll;
+        return out.str();
+    }
+};
+
+// ------ Append / Prepend ------
+
+TEST_F(IndexedLinkedListTest, Append_KeepsStorageCompact) {
+    ll->append(40);
+    EXPECT_EQ(str(), "{10, 20, 30, 40}");
+    EXPECT_TRUE(ll->isCompact());
+    EXPECT_EQ(ll->getHeadSlot(), 0u);
+}
+
+TEST_F(IndexedLinkedListTest, Prepend_BreaksSlotOrder) {
+    ll->prepend(5);
+    EXPECT_EQ(str(), "{5, 10, 20, 30}");
+    EXPECT_FALSE(ll->isCompact());
+    EXPECT_EQ(ll->getLength(), 4);
+}
+
+// ------ Delete ------
+
+TEST_F(IndexedLinkedListTest, DeleteLast_OnCompactStorageShrinks) {
+    ll->deleteLast();
+    EXPECT_EQ(str(), "{10, 20}");
+    EXPECT_TRUE(ll->isCompact());
+    EXPECT_EQ(ll->getCapacity(), 2u);
+}
+
+TEST_F(IndexedLinkedListTest, DeleteFirstAndNode) {
+    ll->append(40);
+    ll->deleteFirst();
+    ll->deleteNode(1);
+    EXPECT_EQ(str(), "{20, 40}");
+    EXPECT_EQ(ll->getLength(), 2);
+    ll->deleteNode(-1);
+    ll->deleteNode(9);
+    EXPECT_EQ(ll->getLength(), 2);
+}
+
+TEST_F(IndexedLinkedListTest, DeletingEverythingResetsStorage) {
+    ll->deleteFirst();
+    ll->deleteFirst();
+    ll->deleteFirst();
+    EXPECT_EQ(str(), "{}");
+    EXPECT_EQ(ll->getCapacity(), 0u);
+    EXPECT_TRUE(ll->isCompact());
+    ll->deleteLast(); // no-op on empty list
+    ll->append(1);
+    EXPECT_EQ(ll->get(0), 1);
+}
+
+TEST_F(IndexedLinkedListTest, FreedSlotsAreReused) {
+    ll->deleteNode(1);
+    ll->insert(1, 25);
+    EXPECT_EQ(ll->getCapacity(), 3u);
+    EXPECT_EQ(str(), "{10, 25, 30}");
+}
+
+// ------ Get / Set / Insert ------
+
+TEST_F(IndexedLinkedListTest, GetSet) {
+    EXPECT_EQ(ll->get(2), 30);
+    EXPECT_EQ(ll->get(3), INT_MIN);
+    EXPECT_TRUE(ll->set(1, 21));
+    EXPECT_FALSE(ll->set(-1, 0));
+    EXPECT_EQ(ll->get(1), 21);
+}
+
+TEST_F(IndexedLinkedListTest, Insert_Bounds) {
+    EXPECT_TRUE(ll->insert(0, 5));
+    EXPECT_TRUE(ll->insert(4, 40));
+    EXPECT_TRUE(ll->insert(2, 15));
+    EXPECT_FALSE(ll->insert(9, 0));
+    EXPECT_EQ(str(), "{5, 10, 15, 20, 30, 40}");
+}
+
+// ------ Algorithms ------
+
+TEST_F(IndexedLinkedListTest, Reverse) {
+    ll->reverse();
+    EXPECT_EQ(str(), "{30, 20, 10}");
+    ll->append(5);
+    EXPECT_EQ(str(), "{30, 20, 10, 5}");
+}
+
+TEST_F(IndexedLinkedListTest, RemoveDuplicates_UpdatesTail) {
+    ll->append(10);
+    ll->append(30);
+    ll->removeDuplicates();
+    EXPECT_EQ(str(), "{10, 20, 30}");
+    ll->append(40);
+    EXPECT_EQ(str(), "{10, 20, 30, 40}");
+}
+
+TEST(IndexedLinkedListBinaryTest, BinaryToDecimal) {
+    IndexedLinkedList bits(1);
+    bits.append(0);
+    bits.append(1);
+    EXPECT_EQ(bits.binaryToDecimal(), 5);
+}
+
+TEST_F(IndexedLinkedListTest, PartitionList_IsStable) {
+    ll->prepend(35);
+    ll->append(5);
+    ll->partitionList(25); // 35 10 20 30 5 -> 10 20 5 35 30
+    EXPECT_EQ(str(), "{10, 20, 5, 35, 30}");
+    ll->append(1);
+    EXPECT_EQ(str(), "{10, 20, 5, 35, 30, 1}");
+}
+
+// ------ Compact ------
+
+TEST_F(IndexedLinkedListTest, Compact_RenumbersInTraversalOrder) {
+    ll->prepend(5);
+    ll->deleteNode(2);
+    ll->reverse();
+    ASSERT_FALSE(ll->isCompact());
+
+    ll->compact();
+    EXPECT_TRUE(ll->isCompact());
+    EXPECT_EQ(str(), "{30, 10, 5}");
+    EXPECT_EQ(ll->getCapacity(), 3u);
+
+    // slot i now holds the i-th element
+    std::uint32_t slot = ll->getHeadSlot();
+    for (std::uint32_t i = 0; i < 3; ++i) {
+        EXPECT_EQ(slot, i);
+        slot = ll->getNextSlot(slot);
+    }
+    EXPECT_EQ(slot, IndexedLinkedList::kNullSlot);
+}
+
+TEST(IndexedLinkedListLayoutTest, EightBytesPerNode) {
+    IndexedLinkedList list(0);
+    for (int i = 1; i < 1000; ++i) {
+        list.append(i);
+    }
+    list.compact();
+    EXPECT_EQ(list.memoryUsage(), 1000u * 8u);
+}
+
+// ------ Copy / Move ------
+
+TEST_F(IndexedLinkedListTest, CopyAndMove) {
+    IndexedLinkedList copy(*ll);
+    ll->deleteFirst();
+    EXPECT_EQ(copy.getLength(), 3);
+
+    IndexedLinkedList moved(std::move(copy));
+    EXPECT_EQ(moved.get(0), 10);
+    EXPECT_EQ(copy.getLength(), 0);
+    copy.append(7);
+    EXPECT_EQ(copy.get(0), 7);
+}
+
+// ------ Randomised comparison against std::vector ------
+
+TEST(IndexedLinkedListModelTest, MatchesVectorUnderRandomEdits) {
+    IndexedLinkedList list(0);
+    std::vector<int> model{0};
+    std::mt19937 rng(3);
+
+    for (int step = 0; step < 5000; ++step) {
+        const int op = static_cast<int>(rng() % 8);
+        const int value = static_cast<int>(rng() % 50);
+        const int size = static_cast<int>(model.size());
+        const int index = static_cast<int>(rng() % (size + 1));
+
+        switch (op) {
+            case 0:
+                list.append(value);
+                model.push_back(value);
+                break;
+            case 1:
+                list.prepend(value);
+                model.insert(model.begin(), value);
+                break;
+            case 2:
+                list.insert(index, value);
+                model.insert(model.begin() + index, value);
+                break;
+            case 3:
+                if (index < size) {
+                    list.deleteNode(index);
+                    model.erase(model.begin() + index);
+                }
+                break;
+            case 4:
+                list.deleteLast();
+                if (!model.empty())
+                    model.pop_back();
+                break;
+            case 5:
+                list.reverse();
+                std::reverse(model.begin(), model.end());
+                break;
+            case 6:
+                list.compact();
+                break;
+            default:
+                if (index < size) {
+                    list.set(index, value);
+                    model[index] = value;
+                }
+                break;
+        }
+
+        ASSERT_EQ(list.getLength(), static_cast<int>(model.size()));
+        for (int i = 0; i < static_cast<int>(model.size()); i += 7) {
+            ASSERT_EQ(list.get(i), model[i]);
+        }
+    }
+}
+
+// ------ Vectorised scans ------
+
+TEST(IndexedLinkedListScanTest, ScansAgreeInCompactAndLinkedLayouts) {
+    IndexedLinkedList compact(0);
+    IndexedLinkedList linked(0);
+    for (int i = 1; i < 100; ++i) {
+        compact.append((i * 37) % 101 - 50);
+        linked.append((i * 37) % 101 - 50);
+    }
+    // force the second list off the fast path without changing its contents
+    linked.prepend(0);
+    linked.deleteFirst();
+    ASSERT_TRUE(compact.isCompact());
+    ASSERT_FALSE(linked.isCompact());
+
+    for (int value : {-50, 0, 7, 49, 1000}) {
+        EXPECT_EQ(compact.indexOf(value), linked.indexOf(value));
+    }
+    EXPECT_EQ(compact.countLess(0), linked.countLess(0));
+    EXPECT_EQ(compact.minValue(), linked.minValue());
+    EXPECT_EQ(compact.maxValue(), linked.maxValue());
+    EXPECT_EQ(compact.sum(), linked.sum());
+}
+
+TEST(IndexedLinkedListScanTest, PartitionAndDedupStayCompact) {
+    IndexedLinkedList list(5);
+    for (int v : {1, 8, 5, 2, 9, 1, 3}) {
+        list.append(v);
+    }
+    list.removeDuplicates();
+    EXPECT_TRUE(list.isCompact());
+    list.partitionList(5);
+    EXPECT_TRUE(list.isCompact());
+
+    std::ostringstream out;
+    out << list;
+    EXPECT_EQ(out.str(), "{1, 2, 3, 5, 8, 9}");
+    EXPECT_EQ(list.get(5), 9);
+}
+
+TEST(IndexedLinkedListScanTest, RemoveDuplicates_LinkedLayout) {
+    IndexedLinkedList list(2);
+    list.append(1);
+    list.append(2);
+    list.prepend(1); // 1 2 1 2, not compact
+    list.removeDuplicates();
+    std::ostringstream out;
+    out << list;
+    EXPECT_EQ(out.str(), "{1, 2}");
+    EXPECT_EQ(list.getLength(), 2);
+}
+
+TEST(IndexedLinkedListScanTest, BinaryToDecimal_LongLists) {
+    IndexedLinkedList compact(1);
+    IndexedLinkedList linked(1);
+    for (int i = 0; i < 40; ++i) {
+        compact.append(i % 3 == 0 ? 1 : 0);
+        linked.append(i % 3 == 0 ? 1 : 0);
+    }
+    linked.prepend(0);
+    linked.deleteFirst();
+    EXPECT_EQ(compact.binaryToDecimal(), linked.binaryToDecimal());
+}
@@ -0,0 +1,246 @@
+#include "intrusivelist.hpp"
+#include <gtest/gtest.h>
+#include <vector>
+
+struct Item : ListHook<> {
+    int value;
+
+    explicit Item(const int value)
+        : value{value} {
+    }
+};
+
+// An element that can sit in two lists at the same time
+struct LruTag {};
+struct TimerTag {};
+
+struct Entry : ListHook<LruTag>, ListHook<TimerTag> {
+    int value;
+
+    explicit Entry(const int value)
+        : value{value} {
+    }
+};
+
+// Base fixture: owns the elements, the list only links them
+class IntrusiveListTest : public ::testing::Test {
+protected:
+    std::vector<Item> items;
+    IntrusiveList<Item> list;
+
+    void SetUp() override {
+        items.reserve(16);
+    }
+
+    void fill(const int count) {
+        for (int i = 1; i <= count; ++i) {
+            items.emplace_back(i);
+        }
+        for (Item& item : items) {
+            list.append(item);
+        }
+    }
+
+    std::vector<int> values() const {
+        std::vector<int> out;
+        list.forEach([&out](const Item& item) { out.push_back(item.value); });
+        return out;
+    }
+
+    // walks the list backwards to make sure the prev pointers agree
+    std::vector<int> valuesBackwards() const {
+        std::vector<int> out;
+        for (Item* item = list.getTail(); item; item = list.prev(*item)) {
+            out.insert(out.begin(), item->value);
+        }
+        return out;
+    }
+};
+
+// ------ Append / Prepend ------
+
+TEST_F(IntrusiveListTest, Append_LinksInOrder) {
+    fill(3);
+    EXPECT_EQ(list.getLength(), 3);
+    EXPECT_EQ(list.getHead()->value, 1);
+    EXPECT_EQ(list.getTail()->value, 3);
+    EXPECT_EQ(values(), (std::vector<int>{1, 2, 3}));
+    EXPECT_EQ(valuesBackwards(), values());
+}
+
+TEST_F(IntrusiveListTest, Prepend_LinksAtHead) {
+    Item a{1}, b{2};
+    list.prepend(a);
+    list.prepend(b);
+    EXPECT_EQ(values(), (std::vector<int>{2, 1}));
+    EXPECT_EQ(list.getTail(), &a);
+    list.clear();
+}
+
+TEST_F(IntrusiveListTest, Append_AlreadyLinkedIsRejected) {
+    fill(2);
+    EXPECT_FALSE(list.append(items[0]));
+    EXPECT_FALSE(list.prepend(items[1]));
+    EXPECT_EQ(list.getLength(), 2);
+}
+
+// ------ Erase ------
+
+TEST_F(IntrusiveListTest, Erase_HeadMiddleTail) {
+    fill(5);
+    EXPECT_TRUE(list.erase(items[2]));
+    EXPECT_EQ(values(), (std::vector<int>{1, 2, 4, 5}));
+    EXPECT_TRUE(list.erase(items[0]));
+    EXPECT_TRUE(list.erase(items[4]));
+    EXPECT_EQ(values(), (std::vector<int>{2, 4}));
+    EXPECT_EQ(valuesBackwards(), values());
+    EXPECT_EQ(list.getLength(), 2);
+    EXPECT_FALSE(items[0].isLinked());
+}
+
+TEST_F(IntrusiveListTest, Erase_UnlinkedIsNoOp) {
+    fill(2);
+    Item loose{99};
+    EXPECT_FALSE(list.erase(loose));
+    EXPECT_EQ(list.getLength(), 2);
+}
+
+TEST_F(IntrusiveListTest, Erase_LastElementEmptiesList) {
+    fill(1);
+    list.erase(items[0]);
+    EXPECT_TRUE(list.empty());
+    EXPECT_EQ(list.getHead(), nullptr);
+    EXPECT_EQ(list.getTail(), nullptr);
+}
+
+TEST_F(IntrusiveListTest, PopFrontAndBack) {
+    fill(3);
+    EXPECT_EQ(list.popFront()->value, 1);
+    EXPECT_EQ(list.popBack()->value, 3);
+    EXPECT_EQ(list.popFront()->value, 2);
+    EXPECT_EQ(list.popFront(), nullptr);
+    EXPECT_EQ(list.popBack(), nullptr);
+}
+
+TEST_F(IntrusiveListTest, MoveToFrontAndBack) {
+    fill(4);
+    list.moveToFront(items[2]);
+    EXPECT_EQ(values(), (std::vector<int>{3, 1, 2, 4}));
+    list.moveToBack(items[0]);
+    EXPECT_EQ(values(), (std::vector<int>{3, 2, 4, 1}));
+    EXPECT_EQ(valuesBackwards(), values());
+}
+
+// ------ Reverse ------
+
+TEST_F(IntrusiveListTest, Reverse_FullList) {
+    fill(4);
+    list.reverse();
+    EXPECT_EQ(values(), (std::vector<int>{4, 3, 2, 1}));
+    EXPECT_EQ(valuesBackwards(), values());
+}
+
+TEST_F(IntrusiveListTest, Reverse_EmptyAndSingle) {
+    list.reverse();
+    EXPECT_TRUE(list.empty());
+    fill(1);
+    list.reverse();
+    EXPECT_EQ(list.getHead(), list.getTail());
+}
+
+// ------ Swap Pairs ------
+
+TEST_F(IntrusiveListTest, SwapPairs_EvenLength) {
+    fill(4);
+    list.swapPairs();
+    EXPECT_EQ(values(), (std::vector<int>{2, 1, 4, 3}));
+    EXPECT_EQ(list.getTail()->value, 3);
+    EXPECT_EQ(valuesBackwards(), values());
+}
+
+TEST_F(IntrusiveListTest, SwapPairs_OddLength) {
+    fill(5);
+    list.swapPairs();
+    EXPECT_EQ(values(), (std::vector<int>{2, 1, 4, 3, 5}));
+    EXPECT_EQ(list.getTail()->value, 5);
+    EXPECT_EQ(valuesBackwards(), values());
+}
+
+// ------ Partition ------
+
+TEST_F(IntrusiveListTest, PartitionList_IsStable) {
+    std::vector<int> input{5, 1, 8, 2, 9, 3};
+    for (int v : input) {
+        items.emplace_back(v);
+    }
+    for (Item& item : items) {
+        list.append(item);
+    }
+
+    list.partitionList([](const Item& item) { return item.value < 5; });
+    EXPECT_EQ(values(), (std::vector<int>{1, 2, 3, 5, 8, 9}));
+    EXPECT_EQ(list.getTail()->value, 9);
+    EXPECT_EQ(valuesBackwards(), values());
+}
+
+TEST_F(IntrusiveListTest, PartitionList_AllOnOneSide) {
+    fill(3);
+    list.partitionList([](const Item&) { return true; });
+    EXPECT_EQ(values(), (std::vector<int>{1, 2, 3}));
+    EXPECT_EQ(list.getTail()->value, 3);
+
+    list.partitionList([](const Item&) { return false; });
+    EXPECT_EQ(values(), (std::vector<int>{1, 2, 3}));
+    EXPECT_EQ(list.getTail()->value, 3);
+}
+
+// ------ Multiple hooks / ownership ------
+
+TEST(IntrusiveListMultiHookTest, ElementInTwoListsAtOnce) {
+    Entry a{1}, b{2}, c{3};
+    IntrusiveList<Entry, LruTag> lru;
+    IntrusiveList<Entry, TimerTag> timers;
+
+    lru.append(a);
+    lru.append(b);
+    lru.append(c);
+    timers.append(c);
+    timers.append(a);
+
+    lru.erase(a);
+    EXPECT_EQ(lru.getLength(), 2);
+    EXPECT_EQ(timers.getLength(), 2);
+    EXPECT_EQ(timers.getTail(), &a);
+}
+
+TEST(IntrusiveListOwnershipTest, DestructorUnlinksButDoesNotDestroy) {
+    Item a{1};
+    {
+        IntrusiveList<Item> list;
+        list.append(a);
+        EXPECT_TRUE(a.isLinked());
+    }
+    EXPECT_FALSE(a.isLinked());
+    EXPECT_EQ(a.value, 1);
+}
+
+TEST(IntrusiveListOwnershipTest, MoveTransfersLinks) {
+    Item a{1}, b{2};
+    IntrusiveList<Item> source;
+    source.append(a);
+    source.append(b);
+
+    IntrusiveList<Item> target(std::move(source));
+    EXPECT_EQ(source.getLength(), 0);
+    EXPECT_EQ(target.getLength(), 2);
+    EXPECT_EQ(target.getHead(), &a);
+}
+
+TEST(IntrusiveListOwnershipTest, CopiedElementIsNotLinked) {
+    Item a{1};
+    IntrusiveList<Item> list;
+    list.append(a);
+    Item copy = a;
+    EXPECT_FALSE(copy.isLinked());
+    EXPECT_TRUE(a.isLinked());
+}
@@ -0,0 +1,109 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <vector>
+#include "latencyhistogram.hpp"
+
+TEST(LatencyHistogramTest, EmptyHistogram) {
+    const LatencyHistogram h;
+    EXPECT_EQ(h.getCount(), 0u);
+    EXPECT_EQ(h.getMin(), 0u);
+    EXPECT_EQ(h.getMax(), 0u);
+    EXPECT_DOUBLE_EQ(h.getMean(), 0.0);
+    EXPECT_EQ(h.valueAtPercentile(99.9), 0u);
+}
+
+TEST(LatencyHistogramTest, SmallValuesAreExact) {
+    LatencyHistogram h;
+    for (std::uint64_t v = 1; v <= 100; ++v) {
+        h.record(v);
+    }
+    EXPECT_EQ(h.getCount(), 100u);
+    EXPECT_EQ(h.getMin(), 1u);
+    EXPECT_EQ(h.getMax(), 100u);
+    EXPECT_DOUBLE_EQ(h.getMean(), 50.5);
+    EXPECT_EQ(h.valueAtPercentile(50), 50u);
+    EXPECT_EQ(h.valueAtPercentile(99), 99u);
+    EXPECT_EQ(h.valueAtPercentile(100), 100u);
+    EXPECT_EQ(h.valueAtPercentile(0), 1u);
+}
+
+TEST(LatencyHistogramTest, BucketsAreContiguousAndMonotonic) {
+    std::size_t previous = LatencyHistogram::bucketIndex(0);
+    for (std::uint64_t v = 1; v < (1u << 20); ++v) {
+        const std::size_t index = LatencyHistogram::bucketIndex(v);
+        ASSERT_TRUE(index == previous || index == previous + 1) << v;
+        ASSERT_LE(v, LatencyHistogram::bucketUpperBound(index)) << v;
+        previous = index;
+    }
+    EXPECT_EQ(LatencyHistogram::bucketUpperBound(
+                  LatencyHistogram::bucketIndex(UINT64_MAX)),
+              UINT64_MAX);
+}
+
+TEST(LatencyHistogramTest, RelativeErrorIsBounded) {
+    for (const std::uint64_t v : {1000ULL, 123456ULL, 987654321ULL, 1ULL << 40}) {
+        const std::uint64_t upper =
+            LatencyHistogram::bucketUpperBound(LatencyHistogram::bucketIndex(v));
+        EXPECT_GE(upper, v);
+        EXPECT_LE(static_cast<double>(upper - v) / static_cast<double>(v), 0.016);
+    }
+}
+
+TEST(LatencyHistogramTest, PercentilesMatchSortedSamples) {
+    std::mt19937_64 rng(42);
+    std::lognormal_distribution<double> dist(6.0, 1.5);
+    std::vector<std::uint64_t> samples;
+    LatencyHistogram h;
+    for (int i = 0; i < 100000; ++i) {
+        const auto v = static_cast<std::uint64_t>(dist(rng));
+        samples.push_back(v);
+        h.record(v);
+    }
+    std::sort(samples.begin(), samples.end());
+
+    for (const double p : {50.0, 90.0, 99.0, 99.9}) {
+        const auto rank = static_cast<std::size_t>(
+            std::ceil(p / 100.0 * static_cast<double>(samples.size())));
+        const std::uint64_t exact = samples[rank - 1];
+        const std::uint64_t reported = h.valueAtPercentile(p);
+        EXPECT_GE(reported, exact) << "p" << p;
+        EXPECT_LE(static_cast<double>(reported),
+                  static_cast<double>(exact) * 1.016 + 1)
+            << "p" << p;
+    }
+    EXPECT_EQ(h.valueAtPercentile(100), samples.back());
+}
+
+TEST(LatencyHistogramTest, MergeAndReset) {
+    LatencyHistogram a;
+    LatencyHistogram b;
+    a.recordMany(10, 3);
+    b.record(5000);
+    b.recordMany(7, 0);
+
+    a.merge(b);
+    EXPECT_EQ(a.getCount(), 4u);
+    EXPECT_EQ(a.getMin(), 10u);
+    EXPECT_EQ(a.getMax(), 5000u);
+    EXPECT_EQ(a.valueAtPercentile(75), 10u);
+    EXPECT_GE(a.valueAtPercentile(100), 5000u);
+
+    a.reset();
+    EXPECT_EQ(a.getCount(), 0u);
+    EXPECT_EQ(a.getMax(), 0u);
+    a.record(3);
+    EXPECT_EQ(a.getMin(), 3u);
+}
+
+TEST(LatencyHistogramTest, TextReportListsPercentiles) {
+    LatencyHistogram h;
+    h.record(42);
+    const std::string text = h.toText();
+    EXPECT_NE(text.find("count=1"), std::string::npos);
+    EXPECT_NE(text.find("p99.9"), std::string::npos);
+    EXPECT_NE(text.find("max"), std::string::npos);
+    EXPECT_NE(text.find("42ns"), std::string::npos);
+}
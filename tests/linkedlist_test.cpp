@@ -1,5 +1,9 @@
 #include "linkedlist.hpp"
 #include <gtest/gtest.h>
+#include <array>
+#include <cstddef>
+#include <memory_resource>
+#include <sstream>
 
 // Base fixture for common setup/teardown
 class BaseLinkedListTest : public ::testing::Test {
@@ -85,6 +89,19 @@ protected:
     }
 };
 
+// ------ Constructor Tests ------
+TEST(LinkedListConstructorTest, DefaultConstructedListIsEmpty) {
+    LinkedList list;
+    EXPECT_EQ(list.getLength(), 0);
+    EXPECT_EQ(list.getHead(), nullptr);
+    EXPECT_EQ(list.getTail(), nullptr);
+    EXPECT_EQ(list.getResource(), nullptr);
+    EXPECT_TRUE(list.isValid());
+
+    list.append(5);
+    EXPECT_EQ(list.getLength(), 1);
+    EXPECT_EQ(list.getHead(), list.getTail());
+}
 
 // ------ Append Tests ------
 TEST_F(EmptyLinkedListTest, Append_ToEmptyList) {
@@ -276,4 +293,372 @@ TEST_F(CopyMoveTest, MoveConstructor_SourceIsNull) {
     EXPECT_EQ(ll->getHead(), nullptr);
     EXPECT_EQ(ll->getTail(), nullptr);
     EXPECT_EQ(ll->getLength(), 0);
-}
\ No newline at end of file
+}
+
+
+// ----- Arena mode -----
+class ArenaLinkedListTest : public ::testing::Test {
+protected:
+    // a fixed buffer with no upstream: any allocation outside it would throw
+    alignas(std::max_align_t) std::array<std::byte, 4096> buffer{};
+    std::pmr::monotonic_buffer_resource arena{
+        buffer.data(), buffer.size(), std::pmr::null_memory_resource()};
+
+    bool inBuffer(const Node* node) const {
+        const auto* p = reinterpret_cast<const std::byte*>(node);
+        return p >= buffer.data() && p < buffer.data() + buffer.size();
+    }
+};
+
+TEST_F(ArenaLinkedListTest, NodesComeFromTheArena) {
+    LinkedList list(1, arena);
+    for (int i = 2; i <= 10; ++i) {
+        list.append(i);
+    }
+    list.prepend(0);
+    list.insert(5, 99);
+
+    EXPECT_TRUE(list.isArenaBacked());
+    EXPECT_EQ(list.getLength(), 12);
+    for (const Node* node = list.getHead(); node; node = node->getNext()) {
+        EXPECT_TRUE(inBuffer(node));
+    }
+}
+
+TEST_F(ArenaLinkedListTest, AlgorithmsWorkOnArenaNodes) {
+    LinkedList list(3, arena);
+    for (const int v : {8, 5, 10, 2, 1}) {
+        list.append(v);
+    }
+    list.partitionList(5);
+    std::ostringstream partitioned;
+    partitioned << list;
+    EXPECT_EQ(partitioned.str(), "{3, 2, 1, 8, 5, 10}");
+
+    list.reverse();
+    EXPECT_EQ(list.getHead()->getData(), 10);
+    EXPECT_EQ(list.findMiddleNode()->getData(), 1);
+
+    list.deleteFirst();
+    list.deleteLast();
+    list.deleteNode(1);
+    EXPECT_EQ(list.getLength(), 3);
+}
+
+TEST_F(ArenaLinkedListTest, ClearForgetsNodesInConstantTime) {
+    LinkedList list(1, arena);
+    for (int i = 0; i < 50; ++i) {
+        list.append(i);
+    }
+    list.clear();
+    EXPECT_EQ(list.getLength(), 0);
+    EXPECT_EQ(list.getHead(), nullptr);
+
+    // still arena-backed and usable after clear()
+    list.append(7);
+    EXPECT_TRUE(inBuffer(list.getHead()));
+    EXPECT_EQ(list.getLength(), 1);
+}
+
+TEST_F(ArenaLinkedListTest, ListMayOutliveArenaRelease) {
+    auto* list = new LinkedList(1, arena);
+    list->append(2);
+    arena.release();
+    // the destructor must not touch the released nodes
+    list->clear();
+    delete list;
+    SUCCEED();
+}
+
+TEST_F(ArenaLinkedListTest, CopiesAreHeapBackedMovesKeepTheArena) {
+    LinkedList list(1, arena);
+    list.append(2);
+
+    LinkedList copy(list);
+    EXPECT_FALSE(copy.isArenaBacked());
+    EXPECT_FALSE(inBuffer(copy.getHead()));
+
+    LinkedList moved(std::move(list));
+    EXPECT_TRUE(moved.isArenaBacked());
+    EXPECT_TRUE(inBuffer(moved.getHead()));
+
+    LinkedList heapList(5);
+    heapList = std::move(moved);
+    EXPECT_TRUE(heapList.isArenaBacked());
+    EXPECT_EQ(heapList.getTail()->getData(), 2);
+
+    arena.release();
+    EXPECT_EQ(copy.getTail()->getData(), 2); // unaffected by the release
+}
+
+
+// ----- Defragmentation -----
+namespace {
+
+// Builds 0..n-1 by inserting at alternating ends of the middle, so consecutive
+// values end up in nodes allocated far apart
+LinkedList scatteredList(const int n) {
+    LinkedList list(0);
+    list.deleteFirst();
+    for (int i = n - 1; i >= 0; --i) {
+        list.prepend(i);
+    }
+    LinkedList shuffled(0);
+    shuffled.deleteFirst();
+    for (int i = 0; i < n; ++i) {
+        shuffled.insert(shuffled.getLength() / 2, i);
+    }
+    // rebuild in sorted order from the shuffled allocations
+    LinkedList result(0);
+    result.deleteFirst();
+    for (const Node* node = list.getHead(); node; node = node->getNext()) {
+        result.append(node->getData());
+        shuffled.deleteFirst();
+    }
+    return result;
+}
+
+std::string toString(const LinkedList& list) {
+    std::ostringstream out;
+    out << list;
+    return out.str();
+}
+
+} // namespace
+
+TEST(LinkedListDefragTest, DefragmentMakesNodesContiguous) {
+    LinkedList list(0);
+    for (int i = 1; i < 200; ++i) {
+        list.insert(i / 2, i); // nodes end up out of allocation order
+    }
+    const std::string before = toString(list);
+    EXPECT_FALSE(list.isContiguous());
+
+    list.defragment();
+    EXPECT_TRUE(list.isContiguous());
+    EXPECT_EQ(toString(list), before);
+    EXPECT_EQ(list.getLength(), 200);
+    EXPECT_EQ(list.getTail()->getNext(), nullptr);
+
+    // the list keeps working normally afterwards
+    list.append(1000);
+    list.deleteFirst();
+    list.deleteNode(50);
+    list.reverse();
+    EXPECT_EQ(list.getHead()->getData(), 1000);
+    EXPECT_EQ(list.getLength(), 199);
+
+    list.defragment(); // frees the previous block as its nodes move out
+    EXPECT_TRUE(list.isContiguous());
+    EXPECT_EQ(list.getHead()->getData(), 1000);
+}
+
+TEST(LinkedListDefragTest, StepMovesABoundedNumberOfNodes) {
+    LinkedList list = scatteredList(100);
+    const std::string before = toString(list);
+
+    int steps = 0;
+    while (!list.defragmentStep(7)) {
+        ++steps;
+        // the list is fully usable between steps
+        EXPECT_EQ(toString(list), before);
+    }
+    EXPECT_EQ(steps, 100 / 7);
+    EXPECT_TRUE(list.isContiguous());
+    EXPECT_EQ(toString(list), before);
+    EXPECT_FALSE(list.defragmentStep(0));
+}
+
+TEST(LinkedListDefragTest, StructuralEditsRestartThePass) {
+    LinkedList list = scatteredList(60);
+    EXPECT_FALSE(list.defragmentStep(20));
+
+    list.deleteNode(10); // could have removed the resume point
+    list.prepend(-1);
+    list.append(99); // appends alone would not restart
+    while (!list.defragmentStep(25)) {
+    }
+    EXPECT_EQ(list.getLength(), 61);
+    EXPECT_EQ(list.getHead()->getData(), -1);
+    EXPECT_EQ(list.getTail()->getData(), 99);
+    EXPECT_EQ(list.get(11)->getData(), 11);
+    EXPECT_TRUE(list.isContiguous());
+}
+
+TEST(LinkedListDefragTest, AppendsDuringAPassAreRelocatedToo) {
+    LinkedList list = scatteredList(10);
+    EXPECT_FALSE(list.defragmentStep(5));
+    for (int i = 10; i < 20; ++i) {
+        list.append(i);
+    }
+    while (!list.defragmentStep(3)) {
+    }
+    EXPECT_EQ(list.getLength(), 20);
+    for (int i = 0; i < 20; ++i) {
+        EXPECT_EQ(list.get(i)->getData(), i);
+    }
+}
+
+TEST(LinkedListDefragTest, EmptyAndSingleNodeLists) {
+    LinkedList list(5);
+    list.defragment();
+    EXPECT_TRUE(list.isContiguous());
+    EXPECT_EQ(list.getHead(), list.getTail());
+    list.deleteFirst();
+    EXPECT_TRUE(list.defragmentStep(10));
+    EXPECT_TRUE(list.isContiguous());
+}
+
+TEST(LinkedListDefragTest, MovedListKeepsItsBlocks) {
+    LinkedList list = scatteredList(30);
+    list.defragment();
+    LinkedList moved(std::move(list));
+    EXPECT_TRUE(moved.isContiguous());
+    moved.deleteFirst();
+    LinkedList target(1);
+    target = std::move(moved);
+    EXPECT_EQ(target.getLength(), 29);
+    target.clear();
+    EXPECT_EQ(target.getLength(), 0);
+}
+
+TEST_F(ArenaLinkedListTest, DefragmentInArenaMode) {
+    LinkedList list(0, arena);
+    for (int i = 1; i < 20; ++i) {
+        list.insert(i / 2, i);
+    }
+    const std::string before = toString(list);
+    list.defragment();
+    EXPECT_TRUE(list.isContiguous());
+    EXPECT_TRUE(inBuffer(list.getHead()));
+    EXPECT_EQ(toString(list), before);
+}
+
+TEST(ArenaLinkedListLifetimeTest, DefragmentedListMayOutliveTheArena) {
+    // arena memory from the heap, so ASan sees any touch after its release
+    auto* arena = new std::pmr::monotonic_buffer_resource(std::pmr::new_delete_resource());
+    auto* list = new LinkedList(0, *arena);
+    for (int i = 1; i < 100; ++i) {
+        list->insert(i / 2, i);
+    }
+    list->defragment();
+    EXPECT_TRUE(list->isContiguous());
+    delete arena;
+    delete list; // must not reach into the destroyed arena
+    SUCCEED();
+}
+
+// ----- Cycle detection and integrity -----
+class CyclicLinkedListTest : public ::testing::Test {
+protected:
+    LinkedList list{0};
+
+    void SetUp() override {
+        for (int i = 1; i < 7; ++i) {
+            list.append(i); // 0 -> 1 -> ... -> 6
+        }
+    }
+};
+
+TEST_F(CyclicLinkedListTest, AcyclicListReportsNoLoop) {
+    EXPECT_EQ(list.findLoopStart(), nullptr);
+    EXPECT_EQ(list.loopLength(), 0);
+    EXPECT_FALSE(list.breakLoop());
+    EXPECT_TRUE(list.isValid());
+    EXPECT_EQ(list.getLength(), 7);
+}
+
+TEST_F(CyclicLinkedListTest, FindsEntryAndLengthOfTailCycle) {
+    Node* entry = list.get(2);
+    list.getTail()->setNext(entry); // 6 -> 2
+    EXPECT_TRUE(list.hasLoop());
+    EXPECT_EQ(list.findLoopStart(), entry);
+    EXPECT_EQ(list.loopLength(), 5);
+    EXPECT_FALSE(list.isValid());
+
+    std::ostringstream out;
+    out << list;
+    EXPECT_EQ(out.str(), "{0, 1, 2, 3, 4, 5, 6, ...}");
+
+    EXPECT_TRUE(list.breakLoop());
+    EXPECT_FALSE(list.hasLoop());
+    EXPECT_EQ(list.getTail()->getData(), 6);
+    EXPECT_EQ(list.getLength(), 7);
+    EXPECT_TRUE(list.isValid());
+}
+
+TEST_F(CyclicLinkedListTest, SelfLoopAndWholeListCycle) {
+    list.getTail()->setNext(list.getTail());
+    EXPECT_EQ(list.findLoopStart(), list.getTail());
+    EXPECT_EQ(list.loopLength(), 1);
+    list.getTail()->setNext(list.getHead());
+    EXPECT_EQ(list.findLoopStart(), list.getHead());
+    EXPECT_EQ(list.loopLength(), 7);
+    EXPECT_TRUE(list.breakLoop());
+    EXPECT_TRUE(list.isValid());
+}
+
+TEST_F(CyclicLinkedListTest, BreakingMidListCycleRecountsLength) {
+    Node* orphan = list.get(5); // 5 -> 6 become unreachable
+    list.get(4)->setNext(list.get(1));
+    EXPECT_EQ(list.loopLength(), 4);
+
+    int lost = -1;
+    EXPECT_TRUE(list.breakLoop(&lost));
+    EXPECT_EQ(lost, 2);
+    EXPECT_EQ(list.getTail()->getData(), 4);
+    EXPECT_EQ(list.getLength(), 5);
+    EXPECT_TRUE(list.isValid());
+
+    // hand the orphans back so the list frees them
+    list.getTail()->setNext(orphan);
+    list.setTail(orphan->getNext());
+    list.setLength(7);
+    EXPECT_TRUE(list.isValid());
+}
+
+TEST_F(CyclicLinkedListTest, TailCycleLosesNoNodes) {
+    list.getTail()->setNext(list.get(3));
+    int lost = -1;
+    EXPECT_TRUE(list.breakLoop(&lost));
+    EXPECT_EQ(lost, 0);
+    EXPECT_FALSE(list.breakLoop(&lost));
+    EXPECT_EQ(lost, 0);
+}
+
+TEST_F(CyclicLinkedListTest, ClearCutsATailCycle) {
+    list.getTail()->setNext(list.get(3));
+    list.clear();
+    EXPECT_EQ(list.getHead(), nullptr);
+    EXPECT_EQ(list.getLength(), 0);
+    EXPECT_TRUE(list.isValid());
+}
+
+TEST_F(CyclicLinkedListTest, IsValidCatchesInconsistentBookkeeping) {
+    list.setLength(6);
+    EXPECT_FALSE(list.isValid());
+    list.setLength(8);
+    EXPECT_FALSE(list.isValid());
+    list.setLength(7);
+    EXPECT_TRUE(list.isValid());
+
+    Node* tail = list.getTail();
+    list.setTail(list.get(5));
+    EXPECT_FALSE(list.isValid());
+    list.setTail(tail);
+
+    LinkedList empty(1);
+    empty.deleteFirst();
+    EXPECT_TRUE(empty.isValid());
+    empty.setLength(1);
+    EXPECT_FALSE(empty.isValid());
+    empty.setLength(0);
+}
+
+#if DS_VALIDATE_LISTS
+TEST_F(CyclicLinkedListTest, ValidationHookAbortsOnCorruption) {
+    list.getTail()->setNext(list.getHead());
+    EXPECT_DEATH(list.prepend(-1), "invariant violated after prepend");
+    list.getTail()->setNext(nullptr);
+}
+#endif
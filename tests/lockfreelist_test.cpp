@@ -0,0 +1,139 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <atomic>
+#include <climits>
+#include <thread>
+#include <vector>
+#include "lockfreelist.hpp"
+
+TEST(LockFreeSortedListTest, EmptyList) {
+    const LockFreeSortedList list;
+    EXPECT_FALSE(list.contains(0));
+    EXPECT_EQ(list.getSize(), 0);
+    EXPECT_TRUE(list.toVector().empty());
+}
+
+TEST(LockFreeSortedListTest, SetSemanticsInOrder) {
+    LockFreeSortedList list;
+    EXPECT_TRUE(list.insert(5));
+    EXPECT_TRUE(list.insert(1));
+    EXPECT_TRUE(list.insert(3));
+    EXPECT_FALSE(list.insert(3));
+    EXPECT_TRUE(list.insert(INT_MIN)); // no clash with the head sentinel
+    EXPECT_EQ(list.toVector(), (std::vector<int>{INT_MIN, 1, 3, 5}));
+    EXPECT_EQ(list.getSize(), 4);
+
+    EXPECT_TRUE(list.contains(3));
+    EXPECT_FALSE(list.contains(4));
+    EXPECT_TRUE(list.remove(3));
+    EXPECT_FALSE(list.remove(3));
+    EXPECT_FALSE(list.contains(3));
+    EXPECT_TRUE(list.remove(INT_MIN));
+    EXPECT_EQ(list.toVector(), (std::vector<int>{1, 5}));
+    EXPECT_EQ(list.getSize(), 2);
+}
+
+TEST(LockFreeSortedListTest, RemovedNodesGoThroughTheDomain) {
+    EpochDomain domain;
+    {
+        LockFreeSortedList list(domain);
+        for (int i = 0; i < 10; ++i) {
+            list.insert(i);
+        }
+        for (int i = 0; i < 10; i += 2) {
+            list.remove(i);
+        }
+        EXPECT_EQ(domain.getPendingCount(), 5u);
+        EXPECT_EQ(&list.getDomain(), &domain);
+    }
+    domain.collect();
+    domain.collect();
+    EXPECT_EQ(domain.getPendingCount(), 0u);
+}
+
+TEST(LockFreeSortedListTest, ConcurrentDisjointInserts) {
+    LockFreeSortedList list;
+    constexpr int kThreads = 4;
+    constexpr int kPerThread = 2000;
+    std::vector<std::thread> threads;
+    for (int t = 0; t < kThreads; ++t) {
+        threads.emplace_back([&list, t] {
+            for (int i = 0; i < kPerThread; ++i) {
+                EXPECT_TRUE(list.insert(i * kThreads + t));
+            }
+        });
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+    const std::vector<int> keys = list.toVector();
+    ASSERT_EQ(keys.size(), static_cast<std::size_t>(kThreads * kPerThread));
+    for (int i = 0; i < kThreads * kPerThread; ++i) {
+        EXPECT_EQ(keys[i], i);
+    }
+    EXPECT_EQ(list.getSize(), kThreads * kPerThread);
+}
+
+TEST(LockFreeSortedListTest, ConcurrentInsertRemoveOnSharedKeys) {
+    LockFreeSortedList list;
+    constexpr int kKeys = 64;
+    std::atomic<int> netInserts{0};
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([&list, &netInserts, t] {
+            unsigned state = 12345u + t;
+            for (int i = 0; i < 20000; ++i) {
+                state = state * 1103515245u + 12345u;
+                const int key = static_cast<int>((state >> 8) % kKeys);
+                switch ((state >> 20) % 3) {
+                    case 0:
+                        if (list.insert(key))
+                            netInserts.fetch_add(1);
+                        break;
+                    case 1:
+                        if (list.remove(key))
+                            netInserts.fetch_sub(1);
+                        break;
+                    default:
+                        list.contains(key);
+                }
+            }
+        });
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+    // every successful insert/remove is accounted for exactly once
+    const std::vector<int> keys = list.toVector();
+    EXPECT_EQ(static_cast<int>(keys.size()), netInserts.load());
+    EXPECT_EQ(list.getSize(), netInserts.load());
+    EXPECT_TRUE(std::is_sorted(keys.begin(), keys.end()));
+    EXPECT_EQ(std::adjacent_find(keys.begin(), keys.end()), keys.end());
+}
+
+TEST(LockFreeSortedListTest, ReadersSeeStableKeysDuringChurn) {
+    LockFreeSortedList list;
+    for (int i = 0; i < 1000; i += 10) {
+        list.insert(i); // multiples of 10 are never touched again
+    }
+    std::atomic<bool> stop{false};
+    std::thread writer([&] {
+        for (int round = 0; round < 200; ++round) {
+            for (int i = 1; i < 1000; i += 10) {
+                list.insert(i);
+            }
+            for (int i = 1; i < 1000; i += 10) {
+                list.remove(i);
+            }
+        }
+        stop.store(true);
+    });
+    int misses = 0;
+    while (!stop.load()) {
+        for (int i = 0; i < 1000; i += 10) {
+            misses += list.contains(i) ? 0 : 1;
+        }
+    }
+    writer.join();
+    EXPECT_EQ(misses, 0);
+}
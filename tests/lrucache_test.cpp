@@ -0,0 +1,167 @@
+#include "lrucache.hpp"
+#include <gtest/gtest.h>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <list>
+
+class LRUCacheTest : public ::testing::Test {
+protected:
+    LRUCache<int, std::string> cache{3};
+};
+
+// ------ Get / Put ------
+
+TEST_F(LRUCacheTest, Get_MissOnEmptyCache) {
+    EXPECT_EQ(cache.get(1), nullptr);
+    EXPECT_EQ(cache.getMisses(), 1u);
+    EXPECT_EQ(cache.getHits(), 0u);
+}
+
+TEST_F(LRUCacheTest, Put_ThenGetHits) {
+    cache.put(1, "one");
+    cache.put(2, "two");
+    ASSERT_NE(cache.get(1), nullptr);
+    EXPECT_EQ(*cache.get(1), "one");
+    EXPECT_EQ(cache.getHits(), 2u);
+    EXPECT_EQ(cache.getSize(), 2u);
+}
+
+TEST_F(LRUCacheTest, Put_ExistingKeyUpdatesValue) {
+    cache.put(1, "one");
+    cache.put(1, "uno");
+    EXPECT_EQ(cache.getSize(), 1u);
+    EXPECT_EQ(*cache.get(1), "uno");
+}
+
+// ------ Eviction ------
+
+TEST_F(LRUCacheTest, Put_EvictsLeastRecentlyUsed) {
+    cache.put(1, "one");
+    cache.put(2, "two");
+    cache.put(3, "three");
+    cache.get(1); // 2 is now least recent
+    cache.put(4, "four");
+
+    EXPECT_EQ(cache.getSize(), 3u);
+    EXPECT_FALSE(cache.contains(2));
+    EXPECT_TRUE(cache.contains(1));
+    EXPECT_TRUE(cache.contains(4));
+    EXPECT_EQ(cache.getEvictions(), 1u);
+    EXPECT_EQ(*cache.mostRecentKey(), 4);
+    EXPECT_EQ(*cache.leastRecentKey(), 3);
+}
+
+TEST_F(LRUCacheTest, Peek_DoesNotChangeRecency) {
+    cache.put(1, "one");
+    cache.put(2, "two");
+    cache.put(3, "three");
+    EXPECT_EQ(*cache.peek(1), "one");
+    cache.put(4, "four");
+    EXPECT_FALSE(cache.contains(1));
+    EXPECT_EQ(cache.getHits(), 0u);
+}
+
+TEST_F(LRUCacheTest, Evict_Manually) {
+    EXPECT_FALSE(cache.evict());
+    cache.put(1, "one");
+    cache.put(2, "two");
+    EXPECT_TRUE(cache.evict());
+    EXPECT_FALSE(cache.contains(1));
+    EXPECT_EQ(cache.getSize(), 1u);
+}
+
+// ------ Erase / Clear ------
+
+TEST_F(LRUCacheTest, Erase_RemovesKeyAndFreesSlot) {
+    cache.put(1, "one");
+    cache.put(2, "two");
+    cache.put(3, "three");
+    EXPECT_TRUE(cache.erase(2));
+    EXPECT_FALSE(cache.erase(2));
+    cache.put(4, "four"); // reuses the freed slot, no eviction
+    EXPECT_EQ(cache.getEvictions(), 0u);
+    EXPECT_TRUE(cache.contains(1));
+    EXPECT_TRUE(cache.contains(3));
+    EXPECT_TRUE(cache.contains(4));
+}
+
+TEST_F(LRUCacheTest, Clear_EmptiesCache) {
+    cache.put(1, "one");
+    cache.put(2, "two");
+    cache.clear();
+    EXPECT_EQ(cache.getSize(), 0u);
+    EXPECT_FALSE(cache.contains(1));
+    cache.put(3, "three");
+    EXPECT_EQ(*cache.get(3), "three");
+}
+
+TEST(LRUCacheEdgeTest, ZeroCapacityStoresNothing) {
+    LRUCache<int, int> cache(0);
+    cache.put(1, 1);
+    EXPECT_EQ(cache.getSize(), 0u);
+    EXPECT_EQ(cache.get(1), nullptr);
+}
+
+TEST(LRUCacheEdgeTest, ResetStats) {
+    LRUCache<int, int> cache(1);
+    cache.put(1, 1);
+    cache.get(1);
+    cache.get(2);
+    cache.resetStats();
+    EXPECT_EQ(cache.getHits(), 0u);
+    EXPECT_EQ(cache.getMisses(), 0u);
+}
+
+// ------ Randomised comparison against a reference implementation ------
+
+TEST(LRUCacheModelTest, MatchesReferenceUnderChurn) {
+    constexpr std::size_t capacity = 64;
+    LRUCache<int, int> cache(capacity);
+
+    // reference: std::list + std::unordered_map
+    std::list<std::pair<int, int>> order;
+    std::unordered_map<int, std::list<std::pair<int, int>>::iterator> index;
+
+    std::mt19937 rng(7);
+    std::uniform_int_distribution<int> keys(0, 200);
+    std::uniform_int_distribution<int> op(0, 9);
+
+    for (int i = 0; i < 20000; ++i) {
+        const int key = keys(rng);
+        const int kind = op(rng);
+
+        if (kind < 5) {
+            int* value = cache.get(key);
+            auto it = index.find(key);
+            ASSERT_EQ(value != nullptr, it != index.end());
+            if (value) {
+                EXPECT_EQ(*value, it->second->second);
+                order.splice(order.begin(), order, it->second);
+            }
+        } else if (kind < 9) {
+            cache.put(key, i);
+            auto it = index.find(key);
+            if (it != index.end()) {
+                it->second->second = i;
+                order.splice(order.begin(), order, it->second);
+            } else {
+                if (order.size() == capacity) {
+                    index.erase(order.back().first);
+                    order.pop_back();
+                }
+                order.emplace_front(key, i);
+                index[key] = order.begin();
+            }
+        } else {
+            const bool erased = cache.erase(key);
+            auto it = index.find(key);
+            ASSERT_EQ(erased, it != index.end());
+            if (erased) {
+                order.erase(it->second);
+                index.erase(it);
+            }
+        }
+        ASSERT_EQ(cache.getSize(), order.size());
+    }
+}
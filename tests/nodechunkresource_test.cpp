@@ -0,0 +1,91 @@
+#include <gtest/gtest.h>
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include "doublylinkedlist.hpp"
+#include "linkedlist.hpp"
+#include "nodechunkresource.hpp"
+
+TEST(NodeChunkResourceTest, BlocksAreHandedOutInOrder) {
+    NodeChunkResource resource(sizeof(Node), 8);
+    EXPECT_EQ(resource.getBlockSize(), 16u);
+
+    auto* first = static_cast<std::byte*>(resource.allocate(sizeof(Node), alignof(Node)));
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(first) % NodeChunkResource::kCacheLine, 0u);
+    for (int i = 1; i < 8; ++i) {
+        auto* next = static_cast<std::byte*>(resource.allocate(sizeof(Node), alignof(Node)));
+        EXPECT_EQ(next, first + i * 16);
+    }
+    EXPECT_EQ(resource.getChunkCount(), 1u);
+    EXPECT_EQ(resource.getBlocksInUse(), 8u);
+
+    EXPECT_NE(resource.allocate(sizeof(Node), alignof(Node)), nullptr); // spills into a second chunk
+    EXPECT_EQ(resource.getChunkCount(), 2u);
+}
+
+TEST(NodeChunkResourceTest, FreedBlocksAreReusedFirst) {
+    NodeChunkResource resource(24, 16);
+    EXPECT_EQ(resource.getBlockSize(), 32u); // rounded up to keep alignment
+
+    void* a = resource.allocate(24, 8);
+    void* b = resource.allocate(24, 8);
+    resource.deallocate(a, 24, 8);
+    EXPECT_EQ(resource.getBlocksInUse(), 1u);
+    EXPECT_EQ(resource.allocate(24, 8), a);
+    resource.deallocate(b, 24, 8);
+    resource.deallocate(a, 24, 8);
+    EXPECT_EQ(resource.getBlocksInUse(), 0u);
+}
+
+TEST(NodeChunkResourceTest, LargeRequestsGoUpstream) {
+    NodeChunkResource resource(16, 4);
+    void* big = resource.allocate(1000, 8);
+    EXPECT_EQ(resource.getChunkCount(), 0u);
+    EXPECT_EQ(resource.getBlocksInUse(), 0u);
+    resource.deallocate(big, 1000, 8);
+}
+
+TEST(NodeChunkResourceTest, ReleaseReturnsEverything) {
+    NodeChunkResource resource(16, 4);
+    for (int i = 0; i < 10; ++i) {
+        EXPECT_NE(resource.allocate(16, 8), nullptr);
+    }
+    EXPECT_EQ(resource.getChunkCount(), 3u);
+    resource.release();
+    EXPECT_EQ(resource.getChunkCount(), 0u);
+    EXPECT_EQ(resource.getBlocksInUse(), 0u);
+    EXPECT_NE(resource.allocate(16, 8), nullptr);
+}
+
+TEST(NodeChunkResourceTest, AppendedListIsContiguousInTraversalOrder) {
+    NodeChunkResource resource(sizeof(Node));
+    LinkedList list(0, &resource);
+    for (int i = 1; i < 1000; ++i) {
+        list.append(i);
+    }
+
+    const Node* previous = list.getHead();
+    for (const Node* node = previous->getNext(); node; node = node->getNext()) {
+        EXPECT_EQ(reinterpret_cast<const std::byte*>(node),
+                  reinterpret_cast<const std::byte*>(previous) + resource.getBlockSize());
+        previous = node;
+    }
+    EXPECT_EQ(list.get(999)->getData(), 999);
+    EXPECT_EQ(list.findKthFromEnd(10)->getData(), 990);
+    list.reverse();
+    EXPECT_EQ(list.get(0)->getData(), 999);
+}
+
+TEST(NodeChunkResourceTest, BacksDoublyLinkedList) {
+    NodeChunkResource resource(sizeof(DNode), 64);
+    {
+        DoublyLinkedList list(0, &resource);
+        for (int i = 1; i < 200; ++i) {
+            list.append(i);
+        }
+        EXPECT_EQ(list.get(150)->value, 150);
+        EXPECT_EQ(list.get(20)->value, 20);
+        EXPECT_EQ(resource.getBlocksInUse(), 200u);
+    }
+    EXPECT_EQ(resource.getBlocksInUse(), 0u);
+}
@@ -0,0 +1,170 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <climits>
+#include <sstream>
+#include <thread>
+#include <vector>
+#include "persistentlist.hpp"
+
+namespace {
+std::string toString(const PersistentList& list) {
+    std::ostringstream out;
+    out << list;
+    return out.str();
+}
+} // namespace
+
+TEST(PersistentListTest, EmptyList) {
+    const PersistentList list;
+    EXPECT_TRUE(list.isEmpty());
+    EXPECT_EQ(list.getLength(), 0);
+    EXPECT_EQ(list.front(), INT_MIN);
+    EXPECT_EQ(list.get(0), INT_MIN);
+    EXPECT_TRUE(list.popFront().isEmpty());
+    EXPECT_EQ(toString(list), "{}");
+    EXPECT_FALSE(list.sharesNodesWith(PersistentList()));
+}
+
+TEST(PersistentListTest, InitializerListKeepsOrder) {
+    const PersistentList list{1, 2, 3};
+    EXPECT_EQ(list.getLength(), 3);
+    EXPECT_EQ(list.front(), 1);
+    EXPECT_EQ(list.get(2), 3);
+    EXPECT_EQ(list.get(3), INT_MIN);
+    EXPECT_EQ(list.get(-1), INT_MIN);
+    EXPECT_EQ(toString(list), "{1, 2, 3}");
+}
+
+TEST(PersistentListTest, PrependLeavesTheSourceUntouched) {
+    const PersistentList base{2, 3};
+    const PersistentList a = base.prepend(1);
+    const PersistentList b = base.prepend(9);
+
+    EXPECT_EQ(toString(base), "{2, 3}");
+    EXPECT_EQ(toString(a), "{1, 2, 3}");
+    EXPECT_EQ(toString(b), "{9, 2, 3}");
+    // both new lists reuse base's nodes instead of copying them
+    EXPECT_TRUE(a.popFront().sharesNodesWith(base));
+    EXPECT_TRUE(b.popFront().sharesNodesWith(base));
+    EXPECT_EQ(base.getHeadUseCount(), 3);
+}
+
+TEST(PersistentListTest, SnapshotSharesEveryNode) {
+    PersistentList live{1, 2, 3};
+    const PersistentList snap = live.snapshot();
+    EXPECT_TRUE(snap.sharesNodesWith(live));
+    EXPECT_EQ(live.getHeadUseCount(), 2);
+
+    live = live.popFront().prepend(10); // the producer moves on
+    EXPECT_EQ(toString(live), "{10, 2, 3}");
+    EXPECT_EQ(toString(snap), "{1, 2, 3}");
+    EXPECT_EQ(snap.getHeadUseCount(), 1);
+    EXPECT_TRUE(live.popFront().sharesNodesWith(snap.popFront()));
+}
+
+TEST(PersistentListTest, PopFrontWalksTheList) {
+    PersistentList list{1, 2, 3};
+    int expected = 1;
+    while (!list.isEmpty()) {
+        EXPECT_EQ(list.front(), expected++);
+        list = list.popFront();
+    }
+    EXPECT_EQ(expected, 4);
+    EXPECT_EQ(list.getLength(), 0);
+}
+
+TEST(PersistentListTest, ReversedBuildsNewNodes) {
+    const PersistentList list{1, 2, 3, 4};
+    const PersistentList reversed = list.reversed();
+    EXPECT_EQ(toString(reversed), "{4, 3, 2, 1}");
+    EXPECT_EQ(reversed.getLength(), 4);
+    EXPECT_EQ(toString(list), "{1, 2, 3, 4}");
+    EXPECT_TRUE(PersistentList().reversed().isEmpty());
+}
+
+TEST(PersistentListTest, IteratesWithRangeFor) {
+    const PersistentList list{5, 6, 7};
+    std::vector<int> seen;
+    for (const int value : list) {
+        seen.push_back(value);
+    }
+    EXPECT_EQ(seen, (std::vector<int>{5, 6, 7}));
+    auto it = list.begin();
+    EXPECT_EQ(*it++, 5);
+    EXPECT_EQ(*it, 6);
+}
+
+TEST(PersistentListTest, MoveLeavesSourceEmpty) {
+    PersistentList list{1, 2};
+    PersistentList moved(std::move(list));
+    EXPECT_EQ(moved.getLength(), 2);
+    EXPECT_TRUE(list.isEmpty()); // NOLINT(bugprone-use-after-move)
+
+    PersistentList target{7};
+    target = std::move(moved);
+    EXPECT_EQ(toString(target), "{1, 2}");
+    const PersistentList& alias = target;
+    target = alias; // self-assignment is a no-op
+    EXPECT_EQ(target.getLength(), 2);
+}
+
+TEST(PersistentListTest, DroppingAVeryLongListDoesNotRecurse) {
+    PersistentList list;
+    for (int i = 0; i < 2000000; ++i) {
+        list = list.prepend(i);
+    }
+    const PersistentList shared = list.popFront();
+    list = PersistentList(); // frees one node, the rest is still shared
+    EXPECT_EQ(shared.getLength(), 1999999);
+    EXPECT_EQ(shared.front(), 1999998);
+    // leaving the scope frees ~2M uniquely owned nodes in one go
+}
+
+TEST(PersistentListTest, SnapshotsAreReadableFromManyThreads) {
+    PersistentList list;
+    for (int i = 0; i < 1000; ++i) {
+        list = list.prepend(i);
+    }
+
+    std::vector<std::thread> readers;
+    std::vector<long long> sums(4, 0);
+    for (int t = 0; t < 4; ++t) {
+        readers.emplace_back([snapshot = list.snapshot(), &sum = sums[t]] {
+            for (const int value : snapshot) {
+                sum += value;
+            }
+        });
+    }
+    list = list.prepend(-1); // the writer keeps going meanwhile
+    for (std::thread& reader : readers) {
+        reader.join();
+    }
+    for (const long long sum : sums) {
+        EXPECT_EQ(sum, 999LL * 1000 / 2);
+    }
+}
+
+TEST(PersistentListTest, ConcurrentDropsFreeTheSharedTailOnce) {
+    for (int round = 0; round < 20; ++round) {
+        PersistentList shared;
+        for (int i = 0; i < 20000; ++i) {
+            shared = shared.prepend(i);
+        }
+
+        // each thread owns its own prefix plus a reference to the shared tail
+        std::atomic<bool> go{false};
+        std::vector<std::thread> droppers;
+        for (int t = 0; t < 4; ++t) {
+            droppers.emplace_back([list = shared.prepend(t), &go]() mutable {
+                while (!go.load(std::memory_order_acquire)) {
+                }
+                list = PersistentList(); // whoever drops last frees ~20k nodes
+            });
+        }
+        shared = PersistentList();
+        go.store(true, std::memory_order_release);
+        for (std::thread& dropper : droppers) {
+            dropper.join();
+        }
+    }
+}
@@ -0,0 +1,147 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <numeric>
+#include <thread>
+#include <vector>
+#include "pipeline.hpp"
+
+namespace {
+Pipeline::Batch drain(Pipeline& pipeline) {
+    Pipeline::Batch all;
+    while (pipeline.popBatch(all, 16) > 0) {
+    }
+    return all;
+}
+
+std::vector<int> range(const int count) {
+    std::vector<int> values(static_cast<std::size_t>(count));
+    std::iota(values.begin(), values.end(), 0);
+    return values;
+}
+} // namespace
+
+TEST(PipelineTest, StagesRunInOrderAndKeepBatchOrder) {
+    Pipeline pipeline(8, 4);
+    EXPECT_TRUE(pipeline.addStage("double", [](const Pipeline::Batch& in, Pipeline::Batch& out) {
+        for (const int value : in)
+            out.push_back(2 * value);
+    }));
+    EXPECT_TRUE(pipeline.addStage("plus one", [](const Pipeline::Batch& in, Pipeline::Batch& out) {
+        for (const int value : in)
+            out.push_back(value + 1);
+    }));
+    EXPECT_EQ(pipeline.getStageCount(), 2);
+    pipeline.start();
+    EXPECT_TRUE(pipeline.isStarted());
+
+    std::thread producer([&pipeline] {
+        EXPECT_EQ(pipeline.pushBatch(range(100)), 100);
+        pipeline.close();
+    });
+    const Pipeline::Batch result = drain(pipeline);
+    producer.join();
+    pipeline.wait();
+
+    ASSERT_EQ(result.size(), 100u);
+    for (int i = 0; i < 100; ++i) {
+        EXPECT_EQ(result[static_cast<std::size_t>(i)], 2 * i + 1);
+    }
+}
+
+TEST(PipelineTest, SetupIsRejectedAfterStart) {
+    Pipeline pipeline(4, 2);
+    EXPECT_FALSE(pipeline.addStage("empty", nullptr));
+    EXPECT_FALSE(pipeline.addStage("no threads", [](const Pipeline::Batch&, Pipeline::Batch&) {}, 0));
+    pipeline.start();
+    EXPECT_FALSE(pipeline.addStage("late", [](const Pipeline::Batch&, Pipeline::Batch&) {}));
+    Pipeline::Batch out;
+    EXPECT_EQ(pipeline.popBatch(out, 4), 0); // no stages: nothing ever comes out
+    EXPECT_TRUE(out.empty());
+}
+
+TEST(PipelineTest, ReductionStageNeedsNoReader) {
+    Pipeline pipeline(16, 8);
+    long long sum = 0;
+    pipeline.addStage("keep even", [](const Pipeline::Batch& in, Pipeline::Batch& out) {
+        for (const int value : in) {
+            if (value % 2 == 0)
+                out.push_back(value);
+        }
+    });
+    pipeline.addStage("sum", [&sum](const Pipeline::Batch& in, Pipeline::Batch&) {
+        sum = std::accumulate(in.begin(), in.end(), sum);
+    });
+    pipeline.start();
+    for (int i = 0; i < 1000; ++i) {
+        EXPECT_TRUE(pipeline.push(i));
+    }
+    pipeline.close();
+    pipeline.wait();
+    EXPECT_EQ(sum, 249500);
+
+    const std::vector<Pipeline::StageMetrics> metrics = pipeline.getMetrics();
+    ASSERT_EQ(metrics.size(), 2u);
+    EXPECT_EQ(metrics[0].name, "keep even");
+    EXPECT_EQ(metrics[0].valuesIn, 1000);
+    EXPECT_EQ(metrics[0].valuesOut, 500);
+    EXPECT_GE(metrics[0].batches, 1000 / 8);
+    EXPECT_EQ(metrics[1].valuesIn, 500);
+    EXPECT_EQ(metrics[1].valuesOut, 0);
+    EXPECT_EQ(metrics[1].queueDepth, 0);
+    EXPECT_GT(metrics[0].valuesPerSecond, 0.0);
+    EXPECT_FALSE(pipeline.push(1)); // closed
+}
+
+TEST(PipelineTest, MultiThreadedStageConservesValues) {
+    Pipeline pipeline(32, 8);
+    pipeline.addStage("square", [](const Pipeline::Batch& in, Pipeline::Batch& out) {
+        for (const int value : in)
+            out.push_back(value * value);
+    }, 4);
+    std::atomic<long long> sum{0};
+    pipeline.addStage("sum", [&sum](const Pipeline::Batch& in, Pipeline::Batch&) {
+        sum.fetch_add(std::accumulate(in.begin(), in.end(), 0LL));
+    }, 2);
+    pipeline.start();
+    pipeline.pushBatch(range(1000));
+    pipeline.close();
+    pipeline.wait();
+    EXPECT_EQ(sum.load(), 332833500LL); // sum of squares 0..999
+    EXPECT_EQ(pipeline.getMetrics()[0].threads, 4);
+}
+
+TEST(PipelineTest, SlowStageCausesBackpressure) {
+    Pipeline pipeline(4, 2);
+    pipeline.addStage("pass", [](const Pipeline::Batch& in, Pipeline::Batch& out) {
+        out = in;
+    });
+    pipeline.addStage("slow", [](const Pipeline::Batch&, Pipeline::Batch&) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    });
+    pipeline.start();
+    pipeline.pushBatch(range(64));
+    pipeline.close();
+    pipeline.wait();
+
+    const std::vector<Pipeline::StageMetrics> metrics = pipeline.getMetrics();
+    EXPECT_GT(metrics[0].blockedSeconds, 0.0); // waited for room in front of "slow"
+    EXPECT_LE(metrics[1].maxQueueDepth, 4); // never buffered past capacity
+    EXPECT_GT(metrics[1].busySeconds, 0.0);
+}
+
+TEST(PipelineTest, DestructorStopsWithUnreadOutput) {
+    Pipeline pipeline(2, 1);
+    pipeline.addStage("copy", [](const Pipeline::Batch& in, Pipeline::Batch& out) {
+        out = in;
+    });
+    pipeline.start();
+    std::thread producer([&pipeline] {
+        for (int i = 0; i < 100 && pipeline.push(i); ++i) {
+        }
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    pipeline.close();
+    producer.join();
+    // nobody reads the output; ~Pipeline must not hang
+}
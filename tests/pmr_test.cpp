@@ -0,0 +1,275 @@
+#include <gtest/gtest.h>
+#include <array>
+#include <atomic>
+#include <climits>
+#include <cstddef>
+#include <cstdlib>
+#include <memory_resource>
+#include <new>
+#include "doublylinkedlist.hpp"
+#include "linkedlist.hpp"
+#include "queue.hpp"
+#include "stack.hpp"
+
+// ------ Global heap instrumentation ------
+// This test binary replaces the global operator new/delete so it can prove
+// that containers built on a custom resource never touch the global heap.
+
+namespace {
+std::atomic<long> globalNewCalls{0};
+
+void* countedAlloc(const std::size_t size, const std::size_t alignment) {
+    globalNewCalls.fetch_add(1, std::memory_order_relaxed);
+    void* p = alignment <= alignof(std::max_align_t)
+        ? std::malloc(size == 0 ? 1 : size)
+        : std::aligned_alloc(alignment, (size + alignment - 1) / alignment * alignment);
+    if (!p)
+        throw std::bad_alloc();
+    return p;
+}
+} // namespace
+
+void* operator new(const std::size_t size) {
+    return countedAlloc(size, alignof(std::max_align_t));
+}
+void* operator new[](const std::size_t size) {
+    return countedAlloc(size, alignof(std::max_align_t));
+}
+void* operator new(const std::size_t size, const std::align_val_t alignment) {
+    return countedAlloc(size, static_cast<std::size_t>(alignment));
+}
+void* operator new[](const std::size_t size, const std::align_val_t alignment) {
+    return countedAlloc(size, static_cast<std::size_t>(alignment));
+}
+void operator delete(void* p) noexcept {
+    std::free(p);
+}
+void operator delete[](void* p) noexcept {
+    std::free(p);
+}
+void operator delete(void* p, std::size_t) noexcept {
+    std::free(p);
+}
+void operator delete[](void* p, std::size_t) noexcept {
+    std::free(p);
+}
+void operator delete(void* p, std::align_val_t) noexcept {
+    std::free(p);
+}
+void operator delete[](void* p, std::align_val_t) noexcept {
+    std::free(p);
+}
+void operator delete(void* p, std::size_t, std::align_val_t) noexcept {
+    std::free(p);
+}
+void operator delete[](void* p, std::size_t, std::align_val_t) noexcept {
+    std::free(p);
+}
+
+// ------ Fixture ------
+
+// Passes everything through to `upstream`, counting outstanding blocks
+class CountingResource : public std::pmr::memory_resource {
+public:
+    explicit CountingResource(std::pmr::memory_resource* upstream)
+        : upstream{upstream} {
+    }
+
+    long allocations = 0;
+    long deallocations = 0;
+
+private:
+    void* do_allocate(const std::size_t bytes, const std::size_t alignment) override {
+        ++allocations;
+        return upstream->allocate(bytes, alignment);
+    }
+
+    void do_deallocate(void* p, const std::size_t bytes, const std::size_t alignment) override {
+        ++deallocations;
+        upstream->deallocate(p, bytes, alignment);
+    }
+
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+        return this == &other;
+    }
+
+    std::pmr::memory_resource* upstream;
+};
+
+class PmrContainersTest : public ::testing::Test {
+protected:
+    // pool -> fixed buffer -> null: running out of the buffer would throw
+    alignas(std::max_align_t) std::array<std::byte, 1 << 16> buffer{};
+    std::pmr::monotonic_buffer_resource backing{
+        buffer.data(), buffer.size(), std::pmr::null_memory_resource()};
+    std::pmr::unsynchronized_pool_resource pool{&backing};
+    CountingResource counting{&pool};
+
+    // global operator new calls made while running `body`
+    template <typename Body>
+    long globalNewsDuring(Body body) {
+        const long before = globalNewCalls.load();
+        body();
+        return globalNewCalls.load() - before;
+    }
+};
+
+// ------ Tests ------
+
+TEST_F(PmrContainersTest, CounterSeesDefaultHeapAllocations) {
+    const long news = globalNewsDuring([] {
+        LinkedList list(1);
+        list.append(2);
+    });
+    EXPECT_EQ(news, 2);
+}
+
+TEST_F(PmrContainersTest, LinkedListUsesOnlyTheResource) {
+    const long news = globalNewsDuring([this] {
+        LinkedList list(5, &counting);
+        for (int i = 0; i < 200; ++i) {
+            list.append(i % 7);
+            list.prepend(i % 3);
+        }
+        list.insert(10, 42);
+        list.partitionList(4);
+        list.reverseBetween(2, 30);
+        list.swapPairs();
+        list.removeDuplicates();
+        list.deleteFirst();
+        list.deleteLast();
+        list.deleteNode(1);
+        EXPECT_EQ(list.getResource(), &counting);
+    });
+    EXPECT_EQ(news, 0);
+    EXPECT_GT(counting.allocations, 400);
+    EXPECT_EQ(counting.allocations, counting.deallocations);
+}
+
+TEST_F(PmrContainersTest, DoublyLinkedListUsesOnlyTheResource) {
+    const long news = globalNewsDuring([this] {
+        DoublyLinkedList list(0, &counting);
+        for (int i = 1; i < 300; ++i) {
+            list.append(i);
+        }
+        list.prepend(-1);
+        list.insertNode(5, 99);
+        list.insertAfter(list.getHead(), 7);
+        list.insertBefore(list.getTail(), 8);
+        list.deleteNode(3);
+        list.eraseAt(list.get(10));
+        list.deleteFirst();
+        list.deleteLast();
+        EXPECT_EQ(list.getResource(), &counting);
+    });
+    EXPECT_EQ(news, 0);
+    EXPECT_GE(counting.allocations, 304);
+    EXPECT_EQ(counting.allocations, counting.deallocations);
+}
+
+TEST_F(PmrContainersTest, StackUsesOnlyTheResource) {
+    const long news = globalNewsDuring([this] {
+        Stack stack(0, &counting);
+        for (int i = 1; i < 500; ++i) {
+            stack.push(i);
+        }
+        for (int i = 0; i < 250; ++i) {
+            stack.pop();
+        }
+        EXPECT_EQ(stack.getHeight(), 250);
+        EXPECT_EQ(stack.getResource(), &counting);
+    });
+    EXPECT_EQ(news, 0);
+    EXPECT_EQ(counting.allocations, 500);
+    EXPECT_EQ(counting.deallocations, 500);
+}
+
+TEST_F(PmrContainersTest, QueueUsesOnlyTheResource) {
+    const long news = globalNewsDuring([this] {
+        Queue queue(0, &counting);
+        for (int i = 1; i < 500; ++i) {
+            queue.enQueue(i);
+        }
+        for (int i = 0; i < 499; ++i) {
+            EXPECT_EQ(queue.deQueue(), i);
+        }
+        queue.clear();
+        queue.enQueue(7);
+        EXPECT_EQ(queue.getResource(), &counting);
+    });
+    EXPECT_EQ(news, 0);
+    EXPECT_EQ(counting.allocations, 501);
+    EXPECT_EQ(counting.deallocations, 501);
+}
+
+TEST_F(PmrContainersTest, DefaultContainersReportNoResource) {
+    const LinkedList list(1);
+    const DoublyLinkedList dlist(1);
+    const Stack stack(1);
+    const Queue queue(1);
+    EXPECT_EQ(list.getResource(), nullptr);
+    EXPECT_EQ(dlist.getResource(), nullptr);
+    EXPECT_EQ(stack.getResource(), nullptr);
+    EXPECT_EQ(queue.getResource(), nullptr);
+}
+
+TEST_F(PmrContainersTest, EmptyContainersAllocateNothingAndKeepTheResource) {
+    const long news = globalNewsDuring([this] {
+        LinkedList list(&counting);
+        DoublyLinkedList dlist(&counting);
+        Stack stack(&counting);
+        Queue queue(&counting);
+        EXPECT_EQ(counting.allocations, 0);
+        EXPECT_EQ(list.getLength(), 0);
+        EXPECT_EQ(dlist.getLength(), 0);
+        EXPECT_EQ(stack.getHeight(), 0);
+        EXPECT_EQ(queue.getSize(), 0);
+        EXPECT_EQ(queue.deQueue(), INT_MIN);
+
+        list.append(1);
+        dlist.append(1);
+        stack.push(1);
+        queue.enQueue(1);
+        EXPECT_EQ(list.getResource(), &counting);
+        EXPECT_EQ(dlist.getResource(), &counting);
+        EXPECT_EQ(stack.getResource(), &counting);
+        EXPECT_EQ(queue.getResource(), &counting);
+    });
+    EXPECT_EQ(news, 0);
+    EXPECT_EQ(counting.allocations, 4);
+    EXPECT_EQ(counting.deallocations, 4);
+}
+
+TEST_F(PmrContainersTest, LinkedListCopyUsesGlobalHeapMoveKeepsResource) {
+    LinkedList list(1, &counting);
+    list.append(2);
+
+    const LinkedList copy(list);
+    EXPECT_EQ(copy.getResource(), nullptr);
+
+    LinkedList moved(std::move(list));
+    EXPECT_EQ(moved.getResource(), &counting);
+    EXPECT_EQ(moved.getLength(), 2);
+
+    LinkedList target(9);
+    target = std::move(moved);
+    EXPECT_EQ(target.getResource(), &counting);
+    EXPECT_EQ(target.getTail()->getData(), 2);
+}
+
+TEST_F(PmrContainersTest, LinkedListDefragmentBlocksComeFromTheResource) {
+    const long news = globalNewsDuring([this] {
+        LinkedList list(0, &counting);
+        for (int i = 1; i < 100; ++i) {
+            list.insert(i / 2, i);
+        }
+        list.defragment();
+        EXPECT_TRUE(list.isContiguous());
+        list.deleteNode(40);
+        list.defragment();
+        EXPECT_EQ(list.getLength(), 99);
+    });
+    // blocks and their bookkeeping come from the resource too
+    EXPECT_EQ(news, 0);
+    EXPECT_EQ(counting.allocations, counting.deallocations);
+}
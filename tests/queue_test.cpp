@@ -21,6 +21,16 @@ TEST_F(QueueTest, ConstructorInitializesCorrectly) {
     EXPECT_EQ(queue->peek(), 10);
 }
 
+TEST(QueueEmptyTest, DefaultConstructedQueueIsEmpty) {
+    Queue queue;
+    EXPECT_EQ(queue.getSize(), 0);
+    EXPECT_EQ(queue.peek(), INT_MIN);
+    EXPECT_EQ(queue.deQueue(), INT_MIN);
+    queue.enQueue(5);
+    EXPECT_EQ(queue.getSize(), 1);
+    EXPECT_EQ(queue.deQueue(), 5);
+}
+
 TEST_F(QueueTest, EnQueueIncreasesSizeAndAddsToBack) {
     queue->enQueue(20);
     EXPECT_EQ(queue->getSize(), 2);
@@ -0,0 +1,120 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <climits>
+#include <thread>
+#include <vector>
+#include "rculist.hpp"
+
+TEST(RcuListTest, EmptyList) {
+    RcuList list;
+    EXPECT_EQ(list.getLength(), 0);
+    EXPECT_EQ(list.get(0), INT_MIN);
+    EXPECT_FALSE(list.contains(0));
+    EXPECT_FALSE(list.remove(0));
+    EXPECT_FALSE(list.set(0, 1));
+    EXPECT_FALSE(list.removeValue(1));
+    EXPECT_TRUE(list.toVector().empty());
+}
+
+TEST(RcuListTest, WritersBuildNewVersions) {
+    RcuList list;
+    list.append(2);
+    list.append(3);
+    list.prepend(1);
+    EXPECT_TRUE(list.insert(3, 5));
+    EXPECT_TRUE(list.insert(3, 4));
+    EXPECT_FALSE(list.insert(7, 0));
+    EXPECT_FALSE(list.insert(-1, 0));
+    EXPECT_EQ(list.toVector(), (std::vector<int>{1, 2, 3, 4, 5}));
+
+    EXPECT_TRUE(list.set(0, 10));
+    EXPECT_TRUE(list.remove(2));
+    EXPECT_TRUE(list.removeValue(5));
+    EXPECT_EQ(list.toVector(), (std::vector<int>{10, 2, 4}));
+    EXPECT_EQ(list.getLength(), 3);
+    EXPECT_EQ(list.get(1), 2);
+    EXPECT_EQ(list.get(3), INT_MIN);
+    EXPECT_TRUE(list.contains(4));
+    EXPECT_FALSE(list.contains(3));
+
+    list.clear();
+    EXPECT_EQ(list.getLength(), 0);
+    list.prepend(7);
+    EXPECT_EQ(list.toVector(), (std::vector<int>{7}));
+}
+
+TEST(RcuListTest, UpdatesRetireOnlyTheReplacedPrefix) {
+    EpochDomain domain;
+    RcuList list(domain);
+    for (int i = 0; i < 10; ++i) {
+        list.append(i); // each append replaces the whole old version
+    }
+    const std::size_t afterAppends = domain.getPendingCount();
+    domain.collect();
+    domain.collect();
+    domain.collect();
+
+    list.set(2, 20); // copies nodes 0 and 1, replaces node 2
+    EXPECT_LE(domain.getPendingCount(), 3u);
+    list.prepend(-1); // replaces nothing
+    EXPECT_LE(domain.getPendingCount(), 3u);
+    EXPECT_GT(afterAppends, 0u);
+    EXPECT_EQ(list.get(3), 20);
+}
+
+TEST(RcuListTest, ReadersNeverSeeAPartialUpdate) {
+    RcuList list;
+    for (int i = 0; i < 64; ++i) {
+        list.append(0);
+    }
+    std::atomic<bool> stop{false};
+    std::thread writer([&] {
+        // every version holds 64 equal values; a mix would be a torn read
+        for (int version = 1; version <= 300; ++version) {
+            for (int i = 0; i < 64; ++i) {
+                list.set(i, version);
+            }
+            list.clear();
+            for (int i = 0; i < 64; ++i) {
+                list.prepend(version);
+            }
+        }
+        stop.store(true);
+    });
+
+    std::vector<std::thread> readers;
+    std::atomic<long> reads{0};
+    for (int r = 0; r < 3; ++r) {
+        readers.emplace_back([&] {
+            while (!stop.load()) {
+                int first = INT_MIN;
+                bool monotone = true;
+                list.forEach([&](const int value) {
+                    // set() walks front to back, so within one version
+                    // values never increase along the list
+                    if (first != INT_MIN && value > first)
+                        monotone = false;
+                    if (first == INT_MIN)
+                        first = value;
+                });
+                EXPECT_TRUE(monotone);
+                reads.fetch_add(1);
+            }
+        });
+    }
+    writer.join();
+    for (std::thread& reader : readers) {
+        reader.join();
+    }
+    EXPECT_GT(reads.load(), 0);
+    EXPECT_EQ(list.toVector(), std::vector<int>(64, 300));
+}
+
+TEST(RcuListTest, FencedDomainWorksToo) {
+    EpochDomain domain(EpochDomain::PinMode::Fenced);
+    RcuList list(domain);
+    list.append(1);
+    std::thread reader([&list] { EXPECT_TRUE(list.contains(1)); });
+    reader.join();
+    EXPECT_EQ(domain.getPinMode(), EpochDomain::PinMode::Fenced);
+}
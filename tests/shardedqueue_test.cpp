@@ -0,0 +1,101 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <climits>
+#include <thread>
+#include <vector>
+#include "shardedqueue.hpp"
+
+TEST(ShardedQueueTest, EmptyQueue) {
+    ShardedQueue queue(4);
+    EXPECT_EQ(queue.getShardCount(), 4);
+    EXPECT_TRUE(queue.isEmpty());
+    EXPECT_EQ(queue.deQueue(), INT_MIN);
+}
+
+TEST(ShardedQueueTest, DefaultsToOneShardPerHardwareThread) {
+    ShardedQueue queue;
+    EXPECT_GE(queue.getShardCount(), 1);
+    EXPECT_EQ(ShardedQueue(-3).getShardCount(), queue.getShardCount());
+}
+
+TEST(ShardedQueueTest, SingleThreadIsFifo) {
+    ShardedQueue queue(4);
+    for (int i = 0; i < 100; ++i) {
+        queue.enQueue(i);
+    }
+    EXPECT_EQ(queue.getSize(), 100);
+    for (int i = 0; i < 100; ++i) {
+        EXPECT_EQ(queue.deQueue(), i);
+    }
+    EXPECT_EQ(queue.deQueue(), INT_MIN);
+    EXPECT_EQ(queue.getStealCount(), 0);
+}
+
+TEST(ShardedQueueTest, ConsumerStealsFromAnotherShard) {
+    ShardedQueue queue(2);
+    const int consumerShard = queue.getLocalShard();
+    bool produced = false;
+    while (!produced) {
+        // consecutive new threads land on alternating shards
+        std::thread([&] {
+            if (queue.getLocalShard() == consumerShard)
+                return;
+            for (int i = 0; i < 3; ++i) {
+                queue.enQueue(i);
+            }
+            produced = true;
+        }).join();
+    }
+    EXPECT_EQ(queue.deQueue(), 0);
+    EXPECT_EQ(queue.deQueue(), 1);
+    EXPECT_EQ(queue.deQueue(), 2);
+    EXPECT_EQ(queue.deQueue(), INT_MIN);
+    EXPECT_EQ(queue.getStealCount(), 3);
+}
+
+TEST(ShardedQueueTest, PerProducerOrderUnderConcurrency) {
+    constexpr int kProducers = 4;
+    constexpr int kConsumers = 4;
+    constexpr int kPerProducer = 20000;
+    ShardedQueue queue(4);
+
+    std::atomic<int> producersLeft{kProducers};
+    std::atomic<long long> consumed{0};
+    std::atomic<long long> sum{0};
+    std::vector<std::thread> threads;
+    for (int p = 0; p < kProducers; ++p) {
+        threads.emplace_back([&, p] {
+            for (int i = 0; i < kPerProducer; ++i) {
+                queue.enQueue(p * kPerProducer + i);
+            }
+            producersLeft.fetch_sub(1);
+        });
+    }
+    for (int c = 0; c < kConsumers; ++c) {
+        threads.emplace_back([&] {
+            // each consumer sees every producer's values in increasing order
+            std::vector<int> last(kProducers, -1);
+            while (true) {
+                const int value = queue.deQueue();
+                if (value == INT_MIN) {
+                    if (producersLeft.load() == 0 && queue.isEmpty())
+                        break;
+                    std::this_thread::yield();
+                    continue;
+                }
+                const int producer = value / kPerProducer;
+                EXPECT_GT(value, last[producer]);
+                last[producer] = value;
+                consumed.fetch_add(1);
+                sum.fetch_add(value);
+            }
+        });
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+    const long long total = static_cast<long long>(kProducers) * kPerProducer;
+    EXPECT_EQ(consumed.load(), total);
+    EXPECT_EQ(sum.load(), total * (total - 1) / 2);
+    EXPECT_TRUE(queue.isEmpty());
+}
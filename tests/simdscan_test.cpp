@@ -0,0 +1,149 @@
+#include "simdscan.hpp"
+#include <gtest/gtest.h>
+#include <climits>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+// Runs every kernel test against each instruction set this CPU supports
+class SimdScanTest : public ::testing::TestWithParam<simd::Level> {
+protected:
+    const simd::Kernels& kernels() const {
+        return simd::kernelsFor(GetParam());
+    }
+
+    void SetUp() override {
+        if (GetParam() > simd::detectedLevel()) {
+            GTEST_SKIP() << simd::levelName(GetParam())
+                         << " not supported on this CPU";
+        }
+    }
+
+    // sizes around the 4- and 8-lane boundaries plus a large one
+    static std::vector<int> randomValues(std::size_t count, unsigned seed) {
+        std::mt19937 rng(seed);
+        std::uniform_int_distribution<int> dist(-1000, 1000);
+        std::vector<int> out(count);
+        for (int& v : out) {
+            v = dist(rng);
+        }
+        return out;
+    }
+
+    static constexpr std::size_t kSizes[] = {0, 1, 3, 4, 5, 7, 8, 9, 15, 16, 17, 31, 32, 33, 100, 1027};
+};
+
+// ------ Find ------
+
+TEST_P(SimdScanTest, Find_MatchesFirstOccurrence) {
+    for (std::size_t size : kSizes) {
+        std::vector<int> data = randomValues(size, 1);
+        for (std::size_t i = 0; i < size; i += 3) {
+            std::ptrdiff_t expected = -1;
+            for (std::size_t j = 0; j < size; ++j) {
+                if (data[j] == data[i]) {
+                    expected = static_cast<std::ptrdiff_t>(j);
+                    break;
+                }
+            }
+            EXPECT_EQ(kernels().find(data.data(), size, data[i]), expected);
+        }
+        EXPECT_EQ(kernels().find(data.data(), size, 5000), -1);
+    }
+}
+
+// ------ CountLess ------
+
+TEST_P(SimdScanTest, CountLess_MatchesScalar) {
+    for (std::size_t size : kSizes) {
+        std::vector<int> data = randomValues(size, 2);
+        for (int limit : {INT_MIN, -500, 0, 1, 999, INT_MAX}) {
+            std::size_t expected = 0;
+            for (int v : data) {
+                expected += v < limit ? 1 : 0;
+            }
+            EXPECT_EQ(kernels().countLess(data.data(), size, limit), expected);
+        }
+    }
+}
+
+// ------ Min / Max / Sum ------
+
+TEST_P(SimdScanTest, MinMaxSum_MatchScalar) {
+    for (std::size_t size : kSizes) {
+        std::vector<int> data = randomValues(size, 3);
+        int lo = INT_MAX;
+        int hi = INT_MIN;
+        long long total = 0;
+        for (int v : data) {
+            lo = v < lo ? v : lo;
+            hi = v > hi ? v : hi;
+            total += v;
+        }
+        EXPECT_EQ(kernels().minValue(data.data(), size), lo);
+        EXPECT_EQ(kernels().maxValue(data.data(), size), hi);
+        EXPECT_EQ(kernels().sum(data.data(), size), total);
+    }
+}
+
+TEST_P(SimdScanTest, Sum_DoesNotOverflow32Bits) {
+    std::vector<int> data(1000, INT_MAX);
+    EXPECT_EQ(kernels().sum(data.data(), data.size()), 1000LL * INT_MAX);
+}
+
+// ------ PackBits ------
+
+TEST_P(SimdScanTest, PackBits_MatchesBinaryToDecimal) {
+    std::mt19937 rng(4);
+    for (std::size_t size : kSizes) {
+        std::vector<int> bits(size);
+        for (int& b : bits) {
+            b = static_cast<int>(rng() & 1u);
+        }
+        std::uint32_t expected = 0;
+        for (int b : bits) {
+            expected = expected * 2u + static_cast<std::uint32_t>(b);
+        }
+        EXPECT_EQ(
+            kernels().packBits(bits.data(), size),
+            static_cast<int>(expected));
+    }
+}
+
+TEST_P(SimdScanTest, PackBits_NonBinaryValuesWrapLikeScalar) {
+    for (std::size_t size : kSizes) {
+        std::vector<int> data = randomValues(size, 5);
+        std::uint32_t expected = 0;
+        for (int v : data) {
+            expected = expected * 2u + static_cast<std::uint32_t>(v);
+        }
+        EXPECT_EQ(
+            kernels().packBits(data.data(), size),
+            static_cast<int>(expected));
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    AllLevels,
+    SimdScanTest,
+    ::testing::Values(simd::Level::Scalar, simd::Level::SSE41, simd::Level::AVX2),
+    [](const ::testing::TestParamInfo<simd::Level>& info) {
+        switch (info.param) {
+            case simd::Level::AVX2:
+                return std::string("AVX2");
+            case simd::Level::SSE41:
+                return std::string("SSE41");
+            default:
+                return std::string("Scalar");
+        }
+    });
+
+TEST(SimdScanDispatchTest, DefaultWrappersUseDetectedLevel) {
+    std::vector<int> data{5, 3, 9, 1};
+    EXPECT_EQ(simd::find(data.data(), data.size(), 9), 2);
+    EXPECT_EQ(simd::countLess(data.data(), data.size(), 5), 2u);
+    EXPECT_EQ(simd::minValue(data.data(), data.size()), 1);
+    EXPECT_EQ(simd::maxValue(data.data(), data.size()), 9);
+    EXPECT_EQ(simd::sum(data.data(), data.size()), 18);
+    EXPECT_NE(simd::levelName(simd::detectedLevel()), nullptr);
+}
@@ -20,6 +20,16 @@ TEST_F(StackTest, ConstructorInitializesStackCorrectly) {
     EXPECT_EQ(stack->getHeight(), 1);
 }
 
+TEST(StackEmptyTest, DefaultConstructedStackIsEmpty) {
+    Stack stack;
+    EXPECT_EQ(stack.getHeight(), 0);
+    EXPECT_EQ(stack.peek(), INT_MIN);
+    EXPECT_EQ(stack.pop(), INT_MIN);
+    stack.push(5);
+    EXPECT_EQ(stack.getHeight(), 1);
+    EXPECT_EQ(stack.pop(), 5);
+}
+
 TEST_F(StackTest, PushIncreasesHeightAndUpdatesTop) {
     stack->push(100);
     EXPECT_EQ(stack->peek(), 100);
@@ -0,0 +1,128 @@
+#include <gtest/gtest.h>
+#include <climits>
+#include <cstdio>
+#include <sstream>
+#include <string>
+#include "trace.hpp"
+
+TEST(TraceTest, ParsesTextWithCommentsAndArguments) {
+    std::istringstream in("# warm-up\n"
+                          "append 5\n"
+                          "\n"
+                          "insert 0 -7   # index, value\n"
+                          "get 1\n"
+                          "deQueue\n");
+    Trace trace;
+    std::string error;
+    ASSERT_TRUE(trace.parseText(in, error)) << error;
+    ASSERT_EQ(trace.getSize(), 4);
+    EXPECT_EQ(trace.getRecords()[0], (TraceRecord{TraceOp::Append, 0, 5}));
+    EXPECT_EQ(trace.getRecords()[1], (TraceRecord{TraceOp::Insert, 0, -7}));
+    EXPECT_EQ(trace.getRecords()[2], (TraceRecord{TraceOp::Get, 1, 0}));
+    EXPECT_EQ(trace.getRecords()[3], (TraceRecord{TraceOp::DeQueue, 0, 0}));
+}
+
+TEST(TraceTest, TextErrorsNameTheLine) {
+    std::string error;
+    Trace unknown;
+    std::istringstream bad("append 1\nshuffle 2\n");
+    EXPECT_FALSE(unknown.parseText(bad, error));
+    EXPECT_NE(error.find("line 2"), std::string::npos);
+    EXPECT_EQ(unknown.getSize(), 1); // records before the error are kept
+
+    Trace missing;
+    std::istringstream tooFew("insert 3\n");
+    EXPECT_FALSE(missing.parseText(tooFew, error));
+    EXPECT_NE(error.find("takes 2"), std::string::npos);
+
+    Trace extra;
+    std::istringstream tooMany("pop 1\n");
+    EXPECT_FALSE(extra.parseText(tooMany, error));
+
+    Trace overflow;
+    std::istringstream huge("push 3000000000\n");
+    EXPECT_FALSE(overflow.parseText(huge, error));
+}
+
+TEST(TraceTest, BinaryRoundTripIsCompact) {
+    Trace trace;
+    trace.add({TraceOp::Push, 0, 3});
+    trace.add({TraceOp::Set, 2, -1});
+    trace.add({TraceOp::EnQueue, 0, INT_MAX});
+    trace.add({TraceOp::Insert, 0, INT_MIN});
+    trace.add({TraceOp::Clear, 0, 0});
+
+    std::stringstream buffer;
+    trace.writeBinary(buffer);
+    // header 5, push 2, set 3, enQueue 1+5, insert 1+1+5, clear 1
+    EXPECT_EQ(buffer.str().size(), 24u);
+
+    Trace loaded;
+    std::string error;
+    ASSERT_TRUE(loaded.parseBinary(buffer, error)) << error;
+    EXPECT_EQ(loaded.getRecords(), trace.getRecords());
+}
+
+TEST(TraceTest, BinaryErrors) {
+    std::string error;
+    Trace trace;
+    std::istringstream noHeader("append 1\n");
+    EXPECT_FALSE(trace.parseBinary(noHeader, error));
+
+    std::string truncated = std::string(Trace::kMagic, 4) + '\x01' + '\x02'; // insert, no args
+    std::istringstream cut(truncated);
+    EXPECT_FALSE(trace.parseBinary(cut, error));
+    EXPECT_NE(error.find("truncated"), std::string::npos);
+
+    std::istringstream badOp(std::string(Trace::kMagic, 4) + '\x01' + '\x7f');
+    EXPECT_FALSE(trace.parseBinary(badOp, error));
+    EXPECT_NE(error.find("opcode"), std::string::npos);
+
+    std::istringstream badVersion(std::string(Trace::kMagic, 4) + '\x09');
+    EXPECT_FALSE(trace.parseBinary(badVersion, error));
+}
+
+TEST(TraceTest, TextRoundTripAndOpNames) {
+    Trace trace;
+    trace.add({TraceOp::DeleteNode, 4, 0});
+    trace.add({TraceOp::Prepend, 0, -2});
+    std::stringstream buffer;
+    trace.writeText(buffer);
+    EXPECT_EQ(buffer.str(), "deleteNode 4\nprepend -2\n");
+
+    Trace loaded;
+    std::string error;
+    ASSERT_TRUE(loaded.parseText(buffer, error));
+    EXPECT_EQ(loaded.getRecords(), trace.getRecords());
+
+    TraceOp op{};
+    EXPECT_TRUE(Trace::parseOpName("deleteLast", op));
+    EXPECT_EQ(op, TraceOp::DeleteLast);
+    EXPECT_FALSE(Trace::parseOpName("DeleteLast", op));
+    EXPECT_STREQ(Trace::opName(TraceOp::EnQueue), "enQueue");
+    EXPECT_EQ(Trace::argumentCount(TraceOp::Set), 2);
+}
+
+TEST(TraceTest, LoadFileDetectsFormat) {
+    Trace trace;
+    trace.add({TraceOp::Append, 0, 1});
+    trace.add({TraceOp::Get, 0, 0});
+    std::string error;
+    const std::string binaryPath = ::testing::TempDir() + "trace_test.bin";
+    const std::string textPath = ::testing::TempDir() + "trace_test.txt";
+    ASSERT_TRUE(trace.saveFile(binaryPath, true, error)) << error;
+    ASSERT_TRUE(trace.saveFile(textPath, false, error)) << error;
+
+    Trace fromBinary;
+    Trace fromText;
+    EXPECT_TRUE(fromBinary.loadFile(binaryPath, error)) << error;
+    EXPECT_TRUE(fromText.loadFile(textPath, error)) << error;
+    EXPECT_EQ(fromBinary.getRecords(), trace.getRecords());
+    EXPECT_EQ(fromText.getRecords(), trace.getRecords());
+    std::remove(binaryPath.c_str());
+    std::remove(textPath.c_str());
+
+    Trace missing;
+    EXPECT_FALSE(missing.loadFile(binaryPath, error));
+    EXPECT_NE(error.find("cannot open"), std::string::npos);
+}
@@ -0,0 +1,220 @@
+#include "xorlinkedlist.hpp"
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <climits>
+#include <random>
+#include <sstream>
+#include <vector>
+
+// Helper class to redirect std::cout
+class XorCoutRedirect {
+private:
+    std::ostringstream buffer;
+    std::streambuf* old;
+
+public:
+    XorCoutRedirect()
+        : buffer(),
+          old(std::cout.rdbuf(buffer.rdbuf())) {
+    }
+
+    ~XorCoutRedirect() {
+        std::cout.rdbuf(old);
+    }
+
+    std::string getString() const {
+        return buffer.str();
+    }
+};
+
+class XorLinkedListTest : public ::testing::Test {
+protected:
+    XorLinkedList* xll = nullptr;
+
+    void SetUp() override {
+        xll = new XorLinkedList(10);
+        xll->append(20);
+        xll->append(30);
+    }
+
+    void TearDown() override {
+        delete xll;
+    }
+
+    std::string captureDisplay() {
+        XorCoutRedirect cr;
+        xll->display();
+        return cr.getString();
+    }
+};
+
+// ------ Layout ------
+
+TEST(XorLinkedListLayoutTest, NodeIsEightBytes) {
+    EXPECT_EQ(sizeof(XNode), 8u);
+}
+
+// ------ Append / Prepend / Display ------
+
+TEST_F(XorLinkedListTest, Display_OutputsInOrder) {
+    EXPECT_EQ(captureDisplay(), "{10, 20, 30}\n");
+}
+
+TEST_F(XorLinkedListTest, Append_And_Prepend) {
+    xll->append(40);
+    xll->prepend(5);
+    EXPECT_EQ(xll->getLength(), 5);
+    EXPECT_EQ(xll->getHead(), 5);
+    EXPECT_EQ(xll->getTail(), 40);
+    EXPECT_EQ(captureDisplay(), "{5, 10, 20, 30, 40}\n");
+}
+
+// ------ DeleteFirst / DeleteLast ------
+
+TEST_F(XorLinkedListTest, DeleteFirstAndLast_UntilEmpty) {
+    xll->deleteFirst();
+    EXPECT_EQ(xll->getHead(), 20);
+    xll->deleteLast();
+    EXPECT_EQ(xll->getTail(), 20);
+    xll->deleteLast();
+    EXPECT_EQ(xll->getLength(), 0);
+    EXPECT_EQ(xll->getHead(), INT_MIN);
+    EXPECT_EQ(xll->getTail(), INT_MIN);
+    xll->deleteFirst(); // empty list is a no-op
+    xll->deleteLast();
+    EXPECT_EQ(captureDisplay(), "{}\n");
+}
+
+// ------ Get / Set ------
+
+TEST_F(XorLinkedListTest, Get_FromBothHalves) {
+    xll->append(40);
+    xll->append(50);
+    EXPECT_EQ(xll->get(0), 10);
+    EXPECT_EQ(xll->get(1), 20);
+    EXPECT_EQ(xll->get(3), 40);
+    EXPECT_EQ(xll->get(4), 50);
+    EXPECT_EQ(xll->get(5), INT_MIN);
+    EXPECT_EQ(xll->get(-1), INT_MIN);
+}
+
+TEST_F(XorLinkedListTest, Set_UpdatesValue) {
+    EXPECT_TRUE(xll->set(2, 33));
+    EXPECT_EQ(xll->get(2), 33);
+    EXPECT_FALSE(xll->set(3, 44));
+}
+
+// ------ InsertNode / DeleteNode ------
+
+TEST_F(XorLinkedListTest, InsertNode_Middle) {
+    EXPECT_TRUE(xll->insertNode(1, 15));
+    EXPECT_TRUE(xll->insertNode(3, 25));
+    EXPECT_FALSE(xll->insertNode(9, 99));
+    EXPECT_EQ(captureDisplay(), "{10, 15, 20, 25, 30}\n");
+}
+
+TEST_F(XorLinkedListTest, DeleteNode_Middle) {
+    xll->deleteNode(1);
+    EXPECT_EQ(captureDisplay(), "{10, 30}\n");
+    xll->deleteNode(5); // out of range
+    EXPECT_EQ(xll->getLength(), 2);
+}
+
+// ------ Reverse ------
+
+TEST_F(XorLinkedListTest, Reverse_IsConstantTimeSwap) {
+    xll->reverse();
+    EXPECT_EQ(captureDisplay(), "{30, 20, 10}\n");
+    xll->append(5);
+    xll->prepend(40);
+    EXPECT_EQ(captureDisplay(), "{40, 30, 20, 10, 5}\n");
+}
+
+// ------ Slot reuse / copy / move ------
+
+TEST_F(XorLinkedListTest, DeletedSlotsAreReused) {
+    for (int i = 0; i < 100; ++i) {
+        xll->append(i);
+    }
+    const std::size_t before = xll->memoryUsage();
+    for (int round = 0; round < 10; ++round) {
+        for (int i = 0; i < 100; ++i) {
+            xll->deleteLast();
+        }
+        for (int i = 0; i < 100; ++i) {
+            xll->prepend(i);
+        }
+    }
+    EXPECT_EQ(xll->memoryUsage(), before);
+}
+
+TEST_F(XorLinkedListTest, CopyIsIndependent) {
+    XorLinkedList copy(*xll);
+    xll->deleteFirst();
+    EXPECT_EQ(copy.getLength(), 3);
+    EXPECT_EQ(copy.getHead(), 10);
+}
+
+TEST_F(XorLinkedListTest, MoveLeavesSourceEmptyAndUsable) {
+    XorLinkedList moved(std::move(*xll));
+    EXPECT_EQ(moved.getLength(), 3);
+    EXPECT_EQ(xll->getLength(), 0);
+    xll->append(1);
+    EXPECT_EQ(xll->get(0), 1);
+}
+
+// ------ Randomised comparison against std::vector ------
+
+TEST(XorLinkedListModelTest, MatchesVectorUnderRandomEdits) {
+    XorLinkedList list(0);
+    std::vector<int> model{0};
+    std::mt19937 rng(42);
+
+    for (int step = 0; step < 5000; ++step) {
+        const int op = static_cast<int>(rng() % 7);
+        const int value = static_cast<int>(rng() % 1000);
+        const int size = static_cast<int>(model.size());
+        const int index = size ? static_cast<int>(rng() % (size + 1)) : 0;
+
+        switch (op) {
+            case 0:
+                list.append(value);
+                model.push_back(value);
+                break;
+            case 1:
+                list.prepend(value);
+                model.insert(model.begin(), value);
+                break;
+            case 2:
+                list.insertNode(index, value);
+                model.insert(model.begin() + index, value);
+                break;
+            case 3:
+                if (index < size) {
+                    list.deleteNode(index);
+                    model.erase(model.begin() + index);
+                }
+                break;
+            case 4:
+                list.deleteFirst();
+                if (!model.empty())
+                    model.erase(model.begin());
+                break;
+            case 5:
+                list.deleteLast();
+                if (!model.empty())
+                    model.pop_back();
+                break;
+            default:
+                list.reverse();
+                std::reverse(model.begin(), model.end());
+                break;
+        }
+
+        ASSERT_EQ(list.getLength(), static_cast<int>(model.size()));
+        if (!model.empty()) {
+            const int probe = static_cast<int>(rng() % model.size());
+            ASSERT_EQ(list.get(probe), model[probe]);
+        }
+    }
+}